@@ -0,0 +1,57 @@
+//
+//  AllocateurAligne.h
+//  allocateur pour std::vector dont le bloc commence sur une frontière de ALIGNEMENT octets
+//
+
+#ifndef ALLOCATEURALIGNE_H
+#define ALLOCATEURALIGNE_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+//! \brief Patron d'allocateur dont les blocs sont alignés sur ALIGNEMENT octets (32 pour un registre AVX2)
+//! \brief les tableaux alloués sont contigus comme ceux de std::allocator: seul le début est aligné
+template <typename T, size_t ALIGNEMENT = 32>
+class AllocateurAligne
+{
+public:
+	typedef T value_type;
+
+	template <typename U>
+	struct rebind
+	{
+		typedef AllocateurAligne<U, ALIGNEMENT> other;
+	};
+
+	AllocateurAligne() {}
+	template <typename U>
+	AllocateurAligne(const AllocateurAligne<U, ALIGNEMENT> &) {}
+
+	T * allocate(size_t p_nb)
+	{
+		void * bloc = 0;
+		if (p_nb != 0 && posix_memalign(&bloc, ALIGNEMENT, p_nb * sizeof(T)) != 0)
+			throw std::bad_alloc();
+		return static_cast<T *>(bloc);
+	}
+
+	void deallocate(T * p_bloc, size_t)
+	{
+		free(p_bloc);
+	}
+};
+
+template <typename T, typename U, size_t ALIGNEMENT>
+bool operator==(const AllocateurAligne<T, ALIGNEMENT> &, const AllocateurAligne<U, ALIGNEMENT> &)
+{
+	return true;
+}
+
+template <typename T, typename U, size_t ALIGNEMENT>
+bool operator!=(const AllocateurAligne<T, ALIGNEMENT> &, const AllocateurAligne<U, ALIGNEMENT> &)
+{
+	return false;
+}
+
+#endif
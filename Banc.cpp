@@ -0,0 +1,459 @@
+/**
+ * \file   Banc.cpp
+ * \brief  Banc d'essai des variantes de plus court chemin, sur Metro.txt ou sur des graphes synthétiques
+ *
+ * Programme distinct de TP3:
+ *   g++ -std=c++11 -O2 -pthread Banc.cpp ContratException.cpp BassinFils.cpp TableReperes.cpp
+ *       FichierProjete.cpp LecteurTexte.cpp FloydWarshall.cpp ContexteDense.cpp Instrumentation.cpp -o banc
+ *
+ * Usage: banc [--metro fichier] [--grille c] [--aleatoire n d] [--requetes q] [--lot b] [--graine g]
+ *             [--csv] [--variante nom]... [--ordre hasard|largeur|rcm]...
+ *  - --metro (par défaut, Metro.txt), --grille (c x c sommets, arcs dans les deux sens) et --aleatoire
+ *    (n sommets, d arcs sortants au hasard plus un anneau) choisissent le graphe; on peut en donner plusieurs;
+ *  - q paires origine/destination tirées au hasard (graine g) sont réparties en lots de b requêtes;
+ *    chaque lot est chronométré d'un bloc avec une horloge monotone, et le temps par requête d'un lot
+ *    est la durée du lot divisée par b. Un lot de réchauffement non mesuré précède les mesures;
+ *  - pour chaque variante sont rapportés le minimum, la médiane, le 90e et le 99e centile du temps par
+ *    requête (en microsecondes, sur les lots) et le nombre de sommets solutionnés par seconde;
+ *  - --csv écrit une ligne d'en-tête puis une ligne par (graphe, variante), pour le suivi des régressions;
+ *  - --variante (répétable) limite les mesures aux variantes nommées;
+ *  - --ordre (répétable) mesure chaque graphe à nouveau après l'avoir renuméroté (Graphe::renumeroter())
+ *    dans cet ordre: au hasard, en largeur ou par Cuthill-McKee inversé. Les ordres s'appliquent l'un
+ *    après l'autre (--ordre hasard --ordre rcm: mélanger puis réordonner); les mêmes paires sont
+ *    mesurées et l'écart moyen |i - j| des arcs (numéros internes) indique la localité obtenue.
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "Graphe.h"
+#include "LecteurTexte.h"
+
+using namespace std;
+
+namespace {
+
+typedef unsigned int N;
+
+/** \brief nombre de sommets extraits d'une file de priorité depuis la dernière remise à zéro */
+unsigned long long g_nbSolutionnes = 0;
+
+/**
+ * \class FileComptee
+ * \brief Politique de file de priorité qui délègue à F et compte les sommets solutionnés (extraits)
+ */
+template <typename Cle, typename F>
+class FileComptee {
+public:
+	void initialiser(size_t p_nbSommets, const Cle & p_poidsMax) {
+		m_file.initialiser(p_nbSommets, p_poidsMax);
+	}
+	bool estVide() const {
+		return m_file.estVide();
+	}
+	size_t reqTaille() const {
+		return m_file.reqTaille();
+	}
+	void insererOuDiminuer(unsigned int p_sommet, const Cle & p_cle) {
+		m_file.insererOuDiminuer(p_sommet, p_cle);
+	}
+	unsigned int extraireMin(Cle & p_cle) {
+		++g_nbSolutionnes;
+		return m_file.extraireMin(p_cle);
+	}
+	void vider() {
+		m_file.vider();
+	}
+	static const char * nom() {
+		return F::nom();
+	}
+
+private:
+	F m_file;
+};
+
+typedef FileComptee<N, TasDAire<N> > Tas;
+typedef ContexteRecherche<N, Tas> Contexte;
+
+/** \brief statistiques d'une variante */
+struct mesure {
+	string variante;
+	size_t nbRequetes;
+	vector<double> parRequete;    // microsecondes par requête, un élément par lot
+	double secondes;              // durée totale mesurée
+	unsigned long long nbSolutionnes;
+	bool compteSolutionnes;       // faux si la variante ne passe pas par une file comptée
+};
+
+/** \brief un graphe à mesurer et son nom dans les rapports */
+struct banc {
+	string nom;
+	Graphe<string, N> graphe;
+};
+
+/**
+ * \brief Chronomètre p_requete sur les paires, par lots de p_lot requêtes
+ * \param[in] p_requete appelée avec (origine, destination)
+ */
+template <typename Requete>
+mesure mesurer(const string & p_variante, const vector< pair<unsigned int, unsigned int> > & p_paires,
+		size_t p_lot, bool p_compteSolutionnes, Requete p_requete) {
+	typedef chrono::steady_clock horloge;
+	mesure m;
+	m.variante = p_variante;
+	m.nbRequetes = 0;
+	m.secondes = 0;
+	m.compteSolutionnes = p_compteSolutionnes;
+
+	p_lot = max<size_t>(1, min(p_lot, p_paires.size()));
+	for (size_t i = 0; i < p_lot; ++i)
+		p_requete(p_paires[i].first, p_paires[i].second);
+
+	g_nbSolutionnes = 0;
+	for (size_t debut = 0; debut + p_lot <= p_paires.size(); debut += p_lot) {
+		horloge::time_point t1 = horloge::now();
+		for (size_t i = debut; i < debut + p_lot; ++i)
+			p_requete(p_paires[i].first, p_paires[i].second);
+		horloge::time_point t2 = horloge::now();
+		double secondes = chrono::duration<double>(t2 - t1).count();
+		m.parRequete.push_back(secondes * 1e6 / p_lot);
+		m.secondes += secondes;
+		m.nbRequetes += p_lot;
+	}
+	m.nbSolutionnes = g_nbSolutionnes;
+	return m;
+}
+
+/** \brief centile p (entre 0 et 1) par la méthode du rang le plus proche; p_valeurs est trié */
+double centile(const vector<double> & p_valeurs, double p) {
+	size_t rang = (size_t) (p * p_valeurs.size() + 0.999999);
+	return p_valeurs[rang == 0 ? 0 : min(rang, p_valeurs.size()) - 1];
+}
+
+void rapporter(const string & p_graphe, mesure & p_mesure, bool p_csv) {
+	if (p_mesure.parRequete.empty())
+		return;
+	vector<double> & t = p_mesure.parRequete;
+	sort(t.begin(), t.end());
+	ostringstream debit;
+	if (p_mesure.compteSolutionnes && p_mesure.secondes > 0)
+		debit << (unsigned long long) (p_mesure.nbSolutionnes / p_mesure.secondes);
+	else
+		debit << (p_csv ? "" : "-");
+
+	if (p_csv)
+		cout << p_graphe << ',' << p_mesure.variante << ',' << p_mesure.nbRequetes << ',' << t.size() << ','
+				<< t.front() << ',' << centile(t, 0.5) << ',' << centile(t, 0.9) << ',' << centile(t, 0.99) << ','
+				<< debit.str() << '\n';
+	else
+		cout << "  " << p_mesure.variante << string(p_mesure.variante.size() < 24 ? 24 - p_mesure.variante.size() : 1, ' ')
+				<< "min " << t.front() << "  médiane " << centile(t, 0.5) << "  p90 " << centile(t, 0.9)
+				<< "  p99 " << centile(t, 0.99) << " us/requête  " << debit.str() << " sommets/s\n";
+	cout.flush();
+}
+
+/** \brief grille c x c, arcs vers les 4 voisins, poids au hasard entre 10 et 100 */
+Graphe<string, N> grille(unsigned int p_cote, unsigned int p_graine) {
+	srand(p_graine);
+	Graphe<string, N> g(p_cote * p_cote);
+	for (unsigned int r = 0; r < p_cote; ++r)
+		for (unsigned int c = 0; c < p_cote; ++c) {
+			unsigned int i = r * p_cote + c;
+			ostringstream nom;
+			nom << r << ',' << c;
+			g.nommer(i, nom.str());
+			if (c + 1 < p_cote) {
+				g.ajouteArc(i, i + 1, 10 + rand() % 91);
+				g.ajouteArc(i + 1, i, 10 + rand() % 91);
+			}
+			if (r + 1 < p_cote) {
+				g.ajouteArc(i, i + p_cote, 10 + rand() % 91);
+				g.ajouteArc(i + p_cote, i, 10 + rand() % 91);
+			}
+		}
+	g.figer();
+	return g;
+}
+
+/** \brief n sommets sur un anneau, plus d arcs sortants vers des sommets au hasard; poids entre 10 et 1000 */
+Graphe<string, N> aleatoire(unsigned int p_nbSommets, unsigned int p_degre, unsigned int p_graine) {
+	srand(p_graine);
+	Graphe<string, N> g(p_nbSommets);
+	for (unsigned int i = 0; i < p_nbSommets; ++i) {
+		ostringstream nom;
+		nom << i;
+		g.nommer(i, nom.str());
+		g.ajouteArc(i, (i + 1) % p_nbSommets, 10 + rand() % 991);
+		for (unsigned int k = 0; k < p_degre; ++k) {
+			unsigned int j = rand() % p_nbSommets;
+			if (j != i)
+				g.ajouteArc(i, j, 10 + rand() % 991);
+		}
+	}
+	g.figer();
+	return g;
+}
+
+/** \brief écart moyen entre les numéros internes des deux bouts d'un arc */
+double ecartMoyen(const GrapheCSR<N> & p_arcs) {
+	double total = 0;
+	for (unsigned int i = 0; i < p_arcs.reqNbSommets(); ++i)
+		for (unsigned int k = p_arcs.reqDebut(i); k < p_arcs.reqFin(i); ++k)
+			total += i < p_arcs.reqDestination(k) ? p_arcs.reqDestination(k) - i : i - p_arcs.reqDestination(k);
+	return p_arcs.reqNbArcs() == 0 ? 0 : total / p_arcs.reqNbArcs();
+}
+
+/** \brief renumérote le graphe selon l'ordre nommé: hasard, largeur ou rcm */
+void renumeroter(Graphe<string, N> & p_graphe, const string & p_ordre, unsigned int p_graine) {
+	vector<unsigned int> ordre;
+	if (p_ordre == "hasard") {
+		ordre.resize(p_graphe.reqNbSommets());
+		for (unsigned int i = 0; i < ordre.size(); ++i)
+			ordre[i] = i;
+		srand(p_graine);
+		for (unsigned int i = ordre.size(); i > 1; --i)
+			swap(ordre[i - 1], ordre[rand() % i]);
+	}
+	else if (p_ordre == "largeur")
+		p_graphe.ordreLargeur(ordre);
+	else if (p_ordre == "rcm")
+		p_graphe.ordreCuthillMcKee(ordre);
+	else
+		throw logic_error("--ordre: ordre inconnu: " + p_ordre);
+	p_graphe.renumeroter(ordre);
+}
+
+/** \brief mesure toutes les variantes retenues sur un graphe */
+void mesurerGraphe(banc & p_banc, size_t p_nbRequetes, size_t p_lot, unsigned int p_graine,
+		const set<string> & p_variantes, bool p_csv) {
+	const Graphe<string, N> & g = p_banc.graphe;
+	const unsigned int n = g.reqNbSommets();
+	if (!p_csv)
+		cout << p_banc.nom << ": " << n << " sommets, " << g.reqArcs().reqNbArcs() << " arcs, écart moyen "
+				<< ecartMoyen(g.reqArcs()) << "\n";
+
+	srand(p_graine);
+	vector< pair<unsigned int, unsigned int> > paires(p_nbRequetes);
+	for (size_t i = 0; i < p_nbRequetes; ++i)
+		paires[i] = make_pair(rand() % n, rand() % n);
+	vector< pair<unsigned int, unsigned int> > peu(paires.begin(), paires.begin() + max<size_t>(1, p_nbRequetes / 20));
+
+	Chemin<string, N> chemin;
+	vector< Chemin<string, N> > chemins;
+	vector< pair<unsigned int, string> > etapes;
+	Contexte contexte, contexteArriere;
+	ContexteRecherche<N, FileComptee<N, FileEnsemble<N> > > contexteEnsemble;
+	ContexteRecherche<N, FileComptee<N, TasDAire<N, 2> > > contexteBinaire;
+	ContexteRecherche<N, FileComptee<N, TasRadix<N> > > contexteRadix;
+	ContexteRecherche<N, FileComptee<N, FileDial<N> > > contexteDial;
+	ContexteRecherche<unsigned long long, FileComptee<unsigned long long, TasDAire<unsigned long long> > > contexteLexico;
+	ContextePareto<N> contextePareto;
+	const bool toutes = p_variantes.empty();
+	typedef chrono::steady_clock horloge;
+
+#define VARIANTE(nom) (toutes || p_variantes.count(nom))
+	vector<mesure> mesures;
+	if (VARIANTE("dijkstra") && n <= 4000)
+		mesures.push_back(mesurer("dijkstra", peu, p_lot, false,
+				[&](unsigned int o, unsigned int d) { g.dijkstra(o, d, etapes); }));
+	if (VARIANTE("v2-tas4"))
+		mesures.push_back(mesurer("v2-tas4", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraV2(o, d, chemin, contexte); }));
+	if (VARIANTE("v2-tas2"))
+		mesures.push_back(mesurer("v2-tas2", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraV2(o, d, chemin, contexteBinaire); }));
+	if (VARIANTE("v2-set"))
+		mesures.push_back(mesurer("v2-set", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraV2(o, d, chemin, contexteEnsemble); }));
+	if (VARIANTE("v2-radix"))
+		mesures.push_back(mesurer("v2-radix", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraV2(o, d, chemin, contexteRadix); }));
+	if (VARIANTE("v2-dial"))
+		mesures.push_back(mesurer("v2-dial", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraV2(o, d, chemin, contexteDial); }));
+	if (VARIANTE("dense") && n <= 8000) {
+		ContexteDense<N> contexteDense;
+		g.reqPoids(0, 0);
+		mesures.push_back(mesurer("dense", paires, p_lot, false,
+				[&](unsigned int o, unsigned int d) { g.dijkstraDense(o, d, chemin, contexteDense); }));
+	}
+	if (VARIANTE("bidirectionnel"))
+		mesures.push_back(mesurer("bidirectionnel", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraBidirectionnel(o, d, chemin, contexte, contexteArriere); }));
+	if (VARIANTE("alt8")) {
+		TableReperes reperes;
+		horloge::time_point t1 = horloge::now();
+		g.calculerReperes(min(8u, n), reperes);
+		if (!p_csv)
+			cout << "  (prétraitement ALT: " << chrono::duration<double>(horloge::now() - t1).count() << " s)\n";
+		mesures.push_back(mesurer("alt8", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraALT(o, d, chemin, reperes, contexte); }));
+	}
+	if (VARIANTE("ch")) {
+		HierarchieContraction<N> hierarchie;
+		horloge::time_point t1 = horloge::now();
+		g.construireHierarchie(hierarchie);
+		if (!p_csv)
+			cout << "  (prétraitement CH: " << chrono::duration<double>(horloge::now() - t1).count() << " s)\n";
+		mesures.push_back(mesurer("ch", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraCH(o, d, chemin, hierarchie, contexte, contexteArriere); }));
+	}
+	if (VARIANTE("cache")) {
+		CacheArbres<N> cache(64 * (size_t) n * 2 * sizeof(N));
+		mesures.push_back(mesurer("cache", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraEnCache(o, d, chemin, cache, contexte); }));
+	}
+	if (VARIANTE("un-a-plusieurs")) {
+		vector<unsigned int> destinations;
+		for (unsigned int i = 0; i < 64; ++i)
+			destinations.push_back(rand() % n);
+		vector<N> distances(destinations.size());
+		mesures.push_back(mesurer("un-a-plusieurs", peu, p_lot, true,
+				[&](unsigned int o, unsigned int) { g.unAPlusieurs(o, destinations, &distances[0], contexte); }));
+	}
+	if (VARIANTE("un-a-tous") || VARIANTE("delta-stepping")) {
+		vector<unsigned int> tous(n);
+		for (unsigned int i = 0; i < n; ++i)
+			tous[i] = i;
+		vector<N> distances(n);
+		vector<unsigned int> predecesseurs;
+		if (VARIANTE("un-a-tous"))
+			mesures.push_back(mesurer("un-a-tous", peu, p_lot, true,
+					[&](unsigned int o, unsigned int) { g.unAPlusieurs(o, tous, &distances[0], contexte); }));
+		if (VARIANTE("delta-stepping")) {
+			BassinFils bassin;
+			mesures.push_back(mesurer("delta-stepping", peu, p_lot, false,
+					[&](unsigned int o, unsigned int) { g.deltaStepping(o, distances, predecesseurs, 0, bassin); }));
+		}
+	}
+	if (VARIANTE("horaire")) {
+		ProfilsTemps<N> profils;
+		profils.construire(g.reqArcs(), 86400, vector< vector< ProfilsTemps<N>::point > >(), g.reqVersion());
+		mesures.push_back(mesurer("horaire", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraHoraire(o, d, 8 * 3600, profils, chemin, contexte); }));
+	}
+	if (VARIANTE("correspondances"))
+		mesures.push_back(mesurer("correspondances", paires, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.dijkstraCorrespondances(o, d, 20, true, chemin, contexteLexico); }));
+	if (VARIANTE("pareto"))
+		mesures.push_back(mesurer("pareto", peu, p_lot, true,
+				[&](unsigned int o, unsigned int d) {
+					g.frontPareto(o, d, 20, chemins, 16, contextePareto);
+					g_nbSolutionnes += contextePareto.reqNbEtiquettesCreees();
+				}));
+	if (VARIANTE("yen4"))
+		mesures.push_back(mesurer("yen4", peu, p_lot, true,
+				[&](unsigned int o, unsigned int d) { g.kPlusCourtsChemins(o, d, 4, chemins, contexte); }));
+	if (VARIANTE("toutes-les-paires") && n <= 4000) {
+		TableDistances<N> table;
+		vector< pair<unsigned int, unsigned int> > une(3, make_pair(0u, 0u));
+		mesures.push_back(mesurer("toutes-les-paires", une, 1, false,
+				[&](unsigned int, unsigned int) { g.toutesLesPaires(table, false); }));
+	}
+	if (VARIANTE("floyd-warshall") && n <= 4000) {
+		TableDistances<N> table;
+		vector< pair<unsigned int, unsigned int> > une(3, make_pair(0u, 0u));
+		mesures.push_back(mesurer("floyd-warshall", une, 1, false,
+				[&](unsigned int, unsigned int) { g.floydWarshall(table, false); }));
+	}
+#undef VARIANTE
+
+	for (size_t i = 0; i < mesures.size(); ++i)
+		rapporter(p_banc.nom, mesures[i], p_csv);
+}
+
+unsigned int lireEntier(int p_nbArguments, char * p_arguments[], int & a) {
+	if (++a >= p_nbArguments)
+		throw logic_error(string(p_arguments[a - 1]) + ": valeur manquante");
+	return strtoul(p_arguments[a], 0, 10);
+}
+
+}
+
+int main(int argc, char * argv[]) {
+	try {
+		size_t nbRequetes = 20000, lot = 100;
+		unsigned int graine = 1;
+		bool csv = false;
+		set<string> variantes;
+		vector<string> ordres;
+		vector<banc> bancs;
+		for (int a = 1; a < argc; ++a) {
+			string option(argv[a]);
+			if (option == "--metro") {
+				if (a + 1 >= argc)
+					throw logic_error("--metro: fichier manquant");
+				bancs.push_back(banc());
+				bancs.back().nom = argv[++a];
+				bancs.back().graphe = chargerGrapheTexte(argv[a], 20);
+			}
+			else if (option == "--grille") {
+				unsigned int cote = lireEntier(argc, argv, a);
+				ostringstream nom;
+				nom << "grille" << cote << 'x' << cote;
+				bancs.push_back(banc());
+				bancs.back().nom = nom.str();
+				bancs.back().graphe = grille(cote, graine);
+			}
+			else if (option == "--aleatoire") {
+				unsigned int nb = lireEntier(argc, argv, a);
+				unsigned int degre = lireEntier(argc, argv, a);
+				ostringstream nom;
+				nom << "aleatoire" << nb << 'd' << degre;
+				bancs.push_back(banc());
+				bancs.back().nom = nom.str();
+				bancs.back().graphe = aleatoire(nb, degre, graine);
+			}
+			else if (option == "--requetes")
+				nbRequetes = lireEntier(argc, argv, a);
+			else if (option == "--lot")
+				lot = lireEntier(argc, argv, a);
+			else if (option == "--graine")
+				graine = lireEntier(argc, argv, a);
+			else if (option == "--csv")
+				csv = true;
+			else if (option == "--variante") {
+				if (a + 1 >= argc)
+					throw logic_error("--variante: nom manquant");
+				variantes.insert(argv[++a]);
+			}
+			else if (option == "--ordre") {
+				if (a + 1 >= argc)
+					throw logic_error("--ordre: nom manquant");
+				ordres.push_back(argv[++a]);
+			}
+			else
+				throw logic_error("option inconnue: " + option);
+		}
+		if (bancs.empty()) {
+			bancs.push_back(banc());
+			bancs.back().nom = "Metro.txt";
+			bancs.back().graphe = chargerGrapheTexte("Metro.txt", 20);
+		}
+		if (nbRequetes == 0)
+			throw logic_error("--requetes: au moins une requête");
+
+		if (csv)
+			cout << "graphe,variante,requetes,lots,min_us,mediane_us,p90_us,p99_us,sommets_par_s\n";
+		for (size_t b = 0; b < bancs.size(); ++b) {
+			mesurerGraphe(bancs[b], nbRequetes, lot, graine, variantes, csv);
+			for (size_t o = 0; o < ordres.size(); ++o) {
+				renumeroter(bancs[b].graphe, ordres[o], graine);
+				bancs[b].nom += '/' + ordres[o];
+				mesurerGraphe(bancs[b], nbRequetes, lot, graine, variantes, csv);
+			}
+		}
+	}
+	catch (logic_error & e) {
+		cerr << e.what() << endl;
+		return 1;
+	}
+	return 0;
+}
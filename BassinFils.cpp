@@ -0,0 +1,155 @@
+/**
+ * \file   BassinFils.cpp
+ * \brief  Fichier contenant l'implémentation de la classe BassinFils
+ */
+
+#include "BassinFils.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+thread_local const BassinFils * t_bassin = 0; /*!< le bassin dont le fil courant exécute une tâche, s'il y a lieu */
+thread_local unsigned int t_fil = 0;          /*!< le numéro du fil courant dans ce bassin */
+}
+
+/**
+ * \brief Constructeur: démarre les fils d'exécution, qui attendent un lot
+ * \param[in] p_nbFils le nombre de fils (0 = le nombre de coeurs disponibles)
+ */
+BassinFils::BassinFils(unsigned int p_nbFils) :
+		m_plages(p_nbFils != 0 ? p_nbFils : max(1u, thread::hardware_concurrency())),
+		m_tache(0), m_lot(0), m_nbFilsActifs(0), m_arret(false) {
+	for (unsigned int i = 0; i < m_plages.size(); ++i)
+		m_fils.push_back(thread(&BassinFils::boucleFil, this, i));
+}
+
+/**
+ * \brief Destructeur: arrête et joint les fils d'exécution
+ */
+BassinFils::~BassinFils() {
+	{
+		lock_guard<mutex> verrou(m_verrou);
+		m_arret = true;
+	}
+	m_nouveauLot.notify_all();
+	for (unsigned int i = 0; i < m_fils.size(); ++i)
+		m_fils[i].join();
+}
+
+/**
+ * \brief Obtient le nombre de fils d'exécution
+ */
+unsigned int BassinFils::reqNbFils() const {
+	return m_plages.size();
+}
+
+/**
+ * \brief Exécute p_tache(tache, fil) pour chaque tache de 0 à p_nbTaches-1 et attend la fin du lot
+ * \param[in] p_nbTaches le nombre de tâches
+ * \param[in] p_tache la fonction à exécuter; elle doit pouvoir être appelée en parallèle
+ * \post si une tâche a levé une exception, la première est relancée ici, après la fin du lot
+ * \note appelée depuis une tâche de ce même bassin, elle exécute le lot sur place, dans le fil appelant et
+ *       avec son numéro: les autres fils sont occupés par le lot englobant, qui ne peut finir avant elle
+ */
+void BassinFils::executer(unsigned int p_nbTaches,
+		const function<void(unsigned int, unsigned int)> & p_tache) {
+	if (t_bassin == this) {
+		for (unsigned int i = 0; i < p_nbTaches; ++i)
+			p_tache(i, t_fil);
+		return;
+	}
+
+	lock_guard<mutex> verrouExecution(m_verrouExecution);
+
+	const unsigned int nbFils = m_plages.size();
+	for (unsigned int i = 0; i < nbFils; ++i) {
+		lock_guard<mutex> verrouPlage(m_plages[i].verrou);
+		m_plages[i].debut = (unsigned long long) p_nbTaches * i / nbFils;
+		m_plages[i].fin = (unsigned long long) p_nbTaches * (i + 1) / nbFils;
+	}
+
+	unique_lock<mutex> verrou(m_verrou);
+	m_tache = &p_tache;
+	m_erreur = exception_ptr();
+	m_nbFilsActifs = nbFils;
+	++m_lot;
+	m_nouveauLot.notify_all();
+	m_lotTermine.wait(verrou, [this] {return m_nbFilsActifs == 0;});
+	m_tache = 0;
+
+	if (m_erreur)
+		rethrow_exception(m_erreur);
+}
+
+/**
+ * \brief Boucle d'un fil d'exécution: attend un lot, le traite, puis signale sa fin
+ * \param[in] p_numero le numéro du fil
+ */
+void BassinFils::boucleFil(unsigned int p_numero) {
+	t_bassin = this;
+	t_fil = p_numero;
+	unsigned int dernierLot = 0;
+	for (;;) {
+		const function<void(unsigned int, unsigned int)> * tache;
+		{
+			unique_lock<mutex> verrou(m_verrou);
+			m_nouveauLot.wait(verrou, [&] {return m_arret || m_lot != dernierLot;});
+			if (m_arret)
+				return;
+			dernierLot = m_lot;
+			tache = m_tache;
+		}
+
+		unsigned int numeroTache;
+		while (prendreTache(p_numero, numeroTache)) {
+			try {
+				(*tache)(numeroTache, p_numero);
+			} catch (...) {
+				lock_guard<mutex> verrou(m_verrou);
+				if (!m_erreur)
+					m_erreur = current_exception();
+			}
+		}
+
+		lock_guard<mutex> verrou(m_verrou);
+		if (--m_nbFilsActifs == 0)
+			m_lotTermine.notify_all();
+	}
+}
+
+/**
+ * \brief Obtient la prochaine tâche du fil p_numero, en volant du travail au besoin
+ * \param[in] p_numero le numéro du fil
+ * \param[out] p_tache la tâche obtenue
+ * \return faux si plus aucune tâche ne reste dans le lot
+ */
+bool BassinFils::prendreTache(unsigned int p_numero, unsigned int & p_tache) {
+	{
+		lock_guard<mutex> verrou(m_plages[p_numero].verrou);
+		if (m_plages[p_numero].debut < m_plages[p_numero].fin) {
+			p_tache = m_plages[p_numero].debut++;
+			return true;
+		}
+	}
+
+	const unsigned int nbFils = m_plages.size();
+	for (unsigned int i = 1; i < nbFils; ++i) {
+		plage & victime = m_plages[(p_numero + i) % nbFils];
+		unsigned int debutVol, finVol;
+		{
+			lock_guard<mutex> verrou(victime.verrou);
+			if (victime.debut >= victime.fin)
+				continue;
+			debutVol = victime.fin - (victime.fin - victime.debut + 1) / 2;
+			finVol = victime.fin;
+			victime.fin = debutVol;
+		}
+		lock_guard<mutex> verrou(m_plages[p_numero].verrou);
+		p_tache = debutVol;
+		m_plages[p_numero].debut = debutVol + 1;
+		m_plages[p_numero].fin = finVol;
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,65 @@
+/**
+ * \file   BassinFils.h
+ * \brief  Fichier contenant la déclaration de la classe BassinFils
+ */
+
+#ifndef BASSINFILS_H
+#define BASSINFILS_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+/**
+ * \class BassinFils
+ * \brief Bassin de fils d'exécution persistants, avec vol de travail.
+ *
+ * Un lot de p_nbTaches tâches indépendantes (numérotées 0..p_nbTaches-1) est réparti
+ * en plages contiguës, une par fil. Chaque fil consomme sa plage par le début; un fil
+ * dont la plage est épuisée vole la moitié arrière de la plage d'un autre fil.
+ * La fonction exécutée reçoit le numéro de la tâche et le numéro du fil (0..reqNbFils()-1),
+ * ce qui permet à l'appelant de tenir un espace de travail par fil.
+ * Une tâche peut appeler executer() sur son propre bassin: le lot imbriqué est alors exécuté
+ * séquentiellement dans le fil de cette tâche.
+ */
+class BassinFils
+{
+public:
+	explicit BassinFils(unsigned int p_nbFils = 0);
+	~BassinFils();
+
+	unsigned int reqNbFils() const;
+	void executer(unsigned int p_nbTaches, const std::function<void(unsigned int, unsigned int)> & p_tache);
+
+private:
+	BassinFils(const BassinFils &);
+	BassinFils & operator=(const BassinFils &);
+
+	struct plage
+	{
+		std::mutex verrou;
+		unsigned int debut;
+		unsigned int fin;
+	};
+
+	void boucleFil(unsigned int p_numero);
+	bool prendreTache(unsigned int p_numero, unsigned int & p_tache);
+
+	std::vector<std::thread> m_fils;
+	std::vector<plage> m_plages;              /*!< les tâches restantes de chaque fil */
+
+	std::mutex m_verrouExecution;             /*!< un seul lot à la fois */
+	std::mutex m_verrou;
+	std::condition_variable m_nouveauLot;
+	std::condition_variable m_lotTermine;
+	const std::function<void(unsigned int, unsigned int)> * m_tache;
+	unsigned int m_lot;                       /*!< numéro du lot courant */
+	unsigned int m_nbFilsActifs;
+	bool m_arret;
+	std::exception_ptr m_erreur;              /*!< première exception levée par une tâche du lot */
+};
+
+#endif
@@ -0,0 +1,77 @@
+//
+//  CacheArbres.h
+//  cache LRU des arbres de plus courts chemins des origines les plus demandées
+//
+
+#ifndef CACHEARBRES_H
+#define CACHEARBRES_H
+
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+#include "ContratException.h"
+
+//! \brief Patron de classe pour un cache des arbres de plus courts chemins, par origine
+//! \brief un arbre garde les distances et les prédécesseurs de tous les sommets depuis son origine: toute
+//! \brief requête depuis une origine en cache se résout par la seule reconstruction du chemin.
+//! \brief La mémoire des arbres est bornée par un budget en octets; l'arbre utilisé le moins récemment est
+//! \brief évincé en premier. Chaque arbre est rangé avec la version du graphe qui l'a produit (Graphe::reqVersion());
+//! \brief une recherche avec une autre version vide le cache. Un cache ne sert qu'un seul graphe.
+//! \brief Toutes les méthodes peuvent être appelées par plusieurs fils d'exécution à la fois; un arbre obtenu
+//! \brief reste valide tant que l'appelant garde son pointeur, même s'il est évincé entre-temps.
+//! \brief N est le type pour les poids
+template <typename N>
+class CacheArbres
+{
+public:
+	//! \brief distances et prédécesseurs depuis une origine, indexés par sommet
+	struct arbre
+	{
+		std::vector<N> distances;
+		std::vector<unsigned int> predecesseurs;
+	};
+
+	explicit CacheArbres(size_t p_budgetOctets);
+
+	std::shared_ptr<const arbre> trouver(unsigned int p_origine, unsigned long p_version);
+	void inserer(unsigned int p_origine, unsigned long p_version, const std::shared_ptr<const arbre> & p_arbre);
+	void invalider();
+
+	size_t reqBudget() const;
+	size_t reqOctets() const;
+	size_t reqNbArbres() const;
+	unsigned long reqNbSucces() const;
+	unsigned long reqNbEchecs() const;
+
+private:
+	CacheArbres(const CacheArbres &);
+	CacheArbres & operator=(const CacheArbres &);
+
+	struct entree
+	{
+		unsigned int origine;
+		std::shared_ptr<const arbre> valeur;
+	};
+	typedef typename std::list<entree>::iterator position;
+
+	static size_t taille(const arbre & p_arbre);
+	void vider();
+
+	mutable std::mutex m_verrou;
+	const size_t m_budget;
+	size_t m_octets;
+	unsigned long m_version;                          /*!< version du graphe des arbres en cache */
+	std::list<entree> m_entrees;                      /*!< du plus récemment utilisé au moins récemment utilisé */
+	std::unordered_map<unsigned int, position> m_index; /*!< origine -> position dans m_entrees */
+	unsigned long m_nbSucces;
+	unsigned long m_nbEchecs;
+};
+
+
+#include "CacheArbres.hpp"
+
+#endif
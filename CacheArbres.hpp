@@ -0,0 +1,142 @@
+//
+//  CacheArbres.hpp
+//  cache LRU des arbres de plus courts chemins des origines les plus demandées
+//
+
+#include "CacheArbres.h"
+
+//! \brief		Constructeur
+//! \param[in]	p_budgetOctets la mémoire maximale occupée par les tableaux des arbres en cache
+//! \post		Un cache vide est créé
+template<typename N>
+CacheArbres<N>::CacheArbres(size_t p_budgetOctets)
+	: m_budget(p_budgetOctets), m_octets(0), m_version(0), m_nbSucces(0), m_nbEchecs(0)
+{
+}
+
+//! \brief		Cherche l'arbre de p_origine et le marque comme le plus récemment utilisé
+//! \param[in]	p_version la version courante du graphe; si elle diffère de celle des arbres en cache, le cache est vidé
+//! \return		l'arbre, ou un pointeur nul (un échec) s'il n'est pas en cache
+template<typename N>
+std::shared_ptr<const typename CacheArbres<N>::arbre> CacheArbres<N>::trouver(unsigned int p_origine, unsigned long p_version)
+{
+	std::lock_guard<std::mutex> verrou(m_verrou);
+	if (p_version != m_version)
+	{
+		vider();
+		m_version = p_version;
+	}
+	typename std::unordered_map<unsigned int, position>::iterator itr = m_index.find(p_origine);
+	if (itr == m_index.end())
+	{
+		++m_nbEchecs;
+		return std::shared_ptr<const arbre>();
+	}
+	++m_nbSucces;
+	m_entrees.splice(m_entrees.begin(), m_entrees, itr->second);
+	return itr->second->valeur;
+}
+
+//! \brief		Range l'arbre de p_origine comme le plus récemment utilisé, en évinçant les moins récents au besoin
+//! \param[in]	p_version la version du graphe qui a produit l'arbre; un arbre d'une version périmée est ignoré
+//! \note		un arbre plus grand que le budget n'est pas gardé; si deux fils calculent le même arbre, le dernier rangé reste
+template<typename N>
+void CacheArbres<N>::inserer(unsigned int p_origine, unsigned long p_version, const std::shared_ptr<const arbre> & p_arbre)
+{
+	PRECONDITION(p_arbre);
+	const size_t octets = taille(*p_arbre);
+	std::lock_guard<std::mutex> verrou(m_verrou);
+	if (p_version != m_version)
+	{
+		if (p_version < m_version)
+			return;
+		vider();
+		m_version = p_version;
+	}
+	if (octets > m_budget)
+		return;
+
+	typename std::unordered_map<unsigned int, position>::iterator itr = m_index.find(p_origine);
+	if (itr != m_index.end())
+	{
+		m_octets -= taille(*itr->second->valeur);
+		m_entrees.erase(itr->second);
+		m_index.erase(itr);
+	}
+	while (m_octets + octets > m_budget)
+	{
+		m_octets -= taille(*m_entrees.back().valeur);
+		m_index.erase(m_entrees.back().origine);
+		m_entrees.pop_back();
+	}
+
+	entree e;
+	e.origine = p_origine;
+	e.valeur = p_arbre;
+	m_entrees.push_front(e);
+	m_index[p_origine] = m_entrees.begin();
+	m_octets += octets;
+}
+
+//! \brief		Vide le cache (par exemple après un changement du graphe qui ne change pas sa version)
+template<typename N>
+void CacheArbres<N>::invalider()
+{
+	std::lock_guard<std::mutex> verrou(m_verrou);
+	vider();
+}
+
+//! \brief		Obtient la mémoire maximale des arbres en cache
+template<typename N>
+size_t CacheArbres<N>::reqBudget() const
+{
+	return m_budget;
+}
+
+//! \brief		Obtient la mémoire occupée par les arbres en cache
+template<typename N>
+size_t CacheArbres<N>::reqOctets() const
+{
+	std::lock_guard<std::mutex> verrou(m_verrou);
+	return m_octets;
+}
+
+//! \brief		Obtient le nombre d'arbres en cache
+template<typename N>
+size_t CacheArbres<N>::reqNbArbres() const
+{
+	std::lock_guard<std::mutex> verrou(m_verrou);
+	return m_entrees.size();
+}
+
+//! \brief		Obtient le nombre de recherches qui ont trouvé leur arbre
+template<typename N>
+unsigned long CacheArbres<N>::reqNbSucces() const
+{
+	std::lock_guard<std::mutex> verrou(m_verrou);
+	return m_nbSucces;
+}
+
+//! \brief		Obtient le nombre de recherches qui n'ont pas trouvé leur arbre
+template<typename N>
+unsigned long CacheArbres<N>::reqNbEchecs() const
+{
+	std::lock_guard<std::mutex> verrou(m_verrou);
+	return m_nbEchecs;
+}
+
+//! \brief		Mémoire occupée par les tableaux d'un arbre
+template<typename N>
+size_t CacheArbres<N>::taille(const arbre & p_arbre)
+{
+	return p_arbre.distances.size() * sizeof(N) + p_arbre.predecesseurs.size() * sizeof(unsigned int);
+}
+
+//! \brief		Retire tous les arbres; le verrou doit être tenu
+template<typename N>
+void CacheArbres<N>::vider()
+{
+	m_entrees.clear();
+	m_index.clear();
+	m_octets = 0;
+}
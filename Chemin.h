@@ -0,0 +1,49 @@
+//
+//  Chemin.h
+//  résultat d'une recherche de plus court chemin: les numéros de sommets et la longueur
+//
+
+#ifndef CHEMIN_H
+#define CHEMIN_H
+
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cstddef>
+
+#include "ContratException.h"
+
+template <typename T, typename N> class Graphe;
+
+//! \brief Patron de classe pour un chemin trouvé dans un Graphe<T,N>
+//! \brief le chemin ne garde que les numéros de sommets; les noms ne sont lus dans le graphe
+//! \brief qu'à la demande, par référence, sans copie
+//! \brief le graphe doit exister tant que les noms du chemin sont consultés
+//! \brief T est le type pour les noms de sommets, N le type pour les poids
+template <typename T, typename N>
+class Chemin
+{
+public:
+	Chemin();
+
+	size_t reqNbSommets() const;
+	unsigned int reqSommet(size_t p_index) const;
+	const T & reqNom(size_t p_index) const;
+	const std::vector<unsigned int> & reqSommets() const;
+	N reqLongueur() const;
+	bool estTrouve() const;
+
+	void exporter(std::vector< std::pair<unsigned int, T> > & p_chemin) const;
+
+private:
+	friend class Graphe<T, N>;
+
+	const Graphe<T, N> * m_graphe;       /*!< le graphe qui donne les noms */
+	std::vector<unsigned int> m_sommets; /*!< les sommets, de l'origine à la destination */
+	N m_longueur;                        /*!< numeric_limits<N>::max() si la destination n'est pas atteignable */
+};
+
+
+#include "Chemin.hpp"
+
+#endif
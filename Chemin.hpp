@@ -0,0 +1,68 @@
+//
+//  Chemin.hpp
+//  résultat d'une recherche de plus court chemin: les numéros de sommets et la longueur
+//
+
+#include "Chemin.h"
+
+//! \brief		Constructeur sans paramètre
+//! \post		Un chemin vide, non trouvé, est créé
+template<typename T, typename N>
+Chemin<T,N>::Chemin() : m_graphe(0), m_longueur(std::numeric_limits<N>::max())
+{
+}
+
+//! \brief		Obtient le nombre de sommets du chemin, origine et destination comprises
+template<typename T, typename N>
+size_t Chemin<T,N>::reqNbSommets() const
+{
+	return m_sommets.size();
+}
+
+//! \brief		Obtient le numéro du p_index-ième sommet du chemin
+template<typename T, typename N>
+unsigned int Chemin<T,N>::reqSommet(size_t p_index) const
+{
+	PRECONDITION(p_index < m_sommets.size());
+	return m_sommets[p_index];
+}
+
+//! \brief		Obtient le nom du p_index-ième sommet du chemin, lu dans le graphe
+template<typename T, typename N>
+const T & Chemin<T,N>::reqNom(size_t p_index) const
+{
+	PRECONDITION(p_index < m_sommets.size() && m_graphe != 0);
+	return m_graphe->reqNom(m_sommets[p_index]);
+}
+
+//! \brief		Obtient les numéros des sommets, de l'origine à la destination
+template<typename T, typename N>
+const std::vector<unsigned int> & Chemin<T,N>::reqSommets() const
+{
+	return m_sommets;
+}
+
+//! \brief		Obtient la longueur du chemin (= numeric_limits<N>::max() si la destination n'est pas atteignable)
+template<typename T, typename N>
+N Chemin<T,N>::reqLongueur() const
+{
+	return m_longueur;
+}
+
+//! \brief		Indique si la destination a été atteinte
+template<typename T, typename N>
+bool Chemin<T,N>::estTrouve() const
+{
+	return m_longueur != std::numeric_limits<N>::max();
+}
+
+//! \brief		Copie le chemin sous forme de paires (numéro, nom)
+//! \param[out]	p_chemin le chemin (le contenu précédent est effacé)
+template<typename T, typename N>
+void Chemin<T,N>::exporter(std::vector< std::pair<unsigned int, T> > & p_chemin) const
+{
+	p_chemin.clear();
+	p_chemin.reserve(m_sommets.size());
+	for (std::vector<unsigned int>::const_iterator itr = m_sommets.begin(); itr != m_sommets.end(); ++itr)
+		p_chemin.push_back(std::pair<unsigned int, T>(*itr, m_graphe->reqNom(*itr)));
+}
@@ -0,0 +1,64 @@
+//
+//  CheminsDynamiques.h
+//  arbre des plus courts chemins d'une source, réparé après chaque changement de poids d'un arc
+//
+
+#ifndef CHEMINSDYNAMIQUES_H
+#define CHEMINSDYNAMIQUES_H
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+#include "ContratException.h"
+#include "GrapheCSR.h"
+#include "FilePriorite.h"
+
+//! \brief Patron de classe pour l'arbre des plus courts chemins depuis une source, maintenu
+//! \brief de façon incrémentale (à la Ramalingam et Reps) quand le poids d'un arc change:
+//! \brief - un arc u -> v raccourci (ou ajouté) ne peut améliorer que v et ses descendants:
+//! \brief   une recherche de Dijkstra repart de v seulement;
+//! \brief - un arc u -> v allongé (ou retiré) ne change rien s'il n'est pas dans l'arbre; sinon,
+//! \brief   seuls les sommets du sous-arbre de v sont touchés: chacun reçoit la meilleure distance
+//! \brief   offerte par ses arcs entrants venant de l'extérieur du sous-arbre, puis une recherche
+//! \brief   de Dijkstra limitée à ces sommets termine la réparation.
+//! \brief Les distances sont toujours celles d'un calcul complet; entre plusieurs plus courts
+//! \brief chemins de même longueur, les prédécesseurs peuvent différer.
+//! \brief N est le type pour les poids
+template <typename N>
+class CheminsDynamiques
+{
+public:
+	CheminsDynamiques();
+
+	void calculer(const GrapheCSR<N> & p_arcs, unsigned int p_source);
+	void mettreAJour(const GrapheCSR<N> & p_arcs, const GrapheCSR<N> & p_arcsInverses,
+			unsigned int p_origine, unsigned int p_destination, const N & p_ancienPoids);
+
+	unsigned int reqSource() const;
+	size_t reqNbSommets() const;
+	N reqDistance(unsigned int p_sommet) const;
+	unsigned int reqPredecesseur(unsigned int p_sommet) const;
+	size_t reqNbSommetsRepares() const;
+	void construireChemin(unsigned int p_destination, std::vector<unsigned int> & p_chemin) const;
+
+	static const unsigned int AUCUN = std::numeric_limits<unsigned int>::max();
+
+private:
+	void diminuer(const GrapheCSR<N> & p_arcs, unsigned int p_origine, unsigned int p_destination, const N & p_poids);
+	void augmenter(const GrapheCSR<N> & p_arcs, const GrapheCSR<N> & p_arcsInverses, unsigned int p_destination);
+	void propager(const GrapheCSR<N> & p_arcs);
+
+	unsigned int m_source;
+	std::vector<N> m_distance;
+	std::vector<unsigned int> m_predecesseur;
+	std::vector<bool> m_estTouche;         /*!< sommets du sous-arbre en cours de réparation */
+	std::vector<unsigned int> m_touches;
+	size_t m_nbSommetsRepares;             /*!< sommets solutionnés par le dernier calcul ou la dernière mise à jour */
+	TasDAire<N> m_file;
+};
+
+
+#include "CheminsDynamiques.hpp"
+
+#endif
@@ -0,0 +1,197 @@
+//
+//  CheminsDynamiques.hpp
+//  arbre des plus courts chemins d'une source, réparé après chaque changement de poids d'un arc
+//
+
+#include <algorithm>
+
+#include "CheminsDynamiques.h"
+
+template<typename N>
+const unsigned int CheminsDynamiques<N>::AUCUN;
+
+//! \brief		Constructeur sans paramètre
+//! \post		Un arbre vide est créé; calculer() doit être appelé avant toute mise à jour
+template<typename N>
+CheminsDynamiques<N>::CheminsDynamiques() : m_source(AUCUN), m_nbSommetsRepares(0)
+{
+}
+
+//! \brief		Calcule l'arbre complet des plus courts chemins depuis p_source
+//! \pre		p_source doit être un sommet du graphe
+template<typename N>
+void CheminsDynamiques<N>::calculer(const GrapheCSR<N> & p_arcs, unsigned int p_source)
+{
+	PRECONDITION(p_source < p_arcs.reqNbSommets());
+	const size_t n = p_arcs.reqNbSommets();
+	m_source = p_source;
+	m_distance.assign(n, std::numeric_limits<N>::max());
+	m_predecesseur.assign(n, AUCUN);
+	m_estTouche.assign(n, false);
+	m_file.initialiser(n, p_arcs.reqPoidsMax());
+
+	m_nbSommetsRepares = 0;
+	m_distance[p_source] = 0;
+	m_file.insererOuDiminuer(p_source, 0);
+	propager(p_arcs);
+}
+
+//! \brief		Répare l'arbre après un changement de l'arc p_origine -> p_destination
+//! \brief		le nouveau poids est lu dans p_arcs; un arc absent de p_arcs a été retiré
+//! \param[in]	p_arcs, p_arcsInverses les arcs du graphe, après le changement
+//! \param[in]	p_ancienPoids le poids avant le changement (numeric_limits<N>::max() pour un arc ajouté)
+//! \pre		calculer() a été appelé pour ce graphe; un seul arc a changé depuis la dernière mise à jour
+template<typename N>
+void CheminsDynamiques<N>::mettreAJour(const GrapheCSR<N> & p_arcs, const GrapheCSR<N> & p_arcsInverses,
+		unsigned int p_origine, unsigned int p_destination, const N & p_ancienPoids)
+{
+	PRECONDITION(m_source != AUCUN && p_arcs.reqNbSommets() == m_distance.size());
+	PRECONDITION(p_origine < m_distance.size() && p_destination < m_distance.size());
+
+	unsigned int k = p_arcs.trouverArc(p_origine, p_destination);
+	N nouveauPoids = k == AUCUN ? std::numeric_limits<N>::max() : p_arcs.reqPoids(k);
+
+	m_nbSommetsRepares = 0;
+	if (nouveauPoids < p_ancienPoids)
+		diminuer(p_arcs, p_origine, p_destination, nouveauPoids);
+	else if (p_ancienPoids < nouveauPoids && m_predecesseur[p_destination] == p_origine)
+		augmenter(p_arcs, p_arcsInverses, p_destination);
+}
+
+//! \brief		Obtient la source de l'arbre
+template<typename N>
+unsigned int CheminsDynamiques<N>::reqSource() const
+{
+	return m_source;
+}
+
+//! \brief		Obtient le nombre de sommets
+template<typename N>
+size_t CheminsDynamiques<N>::reqNbSommets() const
+{
+	return m_distance.size();
+}
+
+//! \brief		Obtient la distance de la source à p_sommet (numeric_limits<N>::max() si non atteignable)
+template<typename N>
+N CheminsDynamiques<N>::reqDistance(unsigned int p_sommet) const
+{
+	PRECONDITION(p_sommet < m_distance.size());
+	return m_distance[p_sommet];
+}
+
+//! \brief		Obtient le prédécesseur de p_sommet dans l'arbre (AUCUN pour la source ou un sommet non atteignable)
+template<typename N>
+unsigned int CheminsDynamiques<N>::reqPredecesseur(unsigned int p_sommet) const
+{
+	PRECONDITION(p_sommet < m_predecesseur.size());
+	return m_predecesseur[p_sommet];
+}
+
+//! \brief		Obtient le nombre de sommets solutionnés par le dernier calcul ou la dernière mise à jour
+template<typename N>
+size_t CheminsDynamiques<N>::reqNbSommetsRepares() const
+{
+	return m_nbSommetsRepares;
+}
+
+//! \brief		Construit le chemin de la source à p_destination
+//! \param[out]	p_chemin les sommets du chemin (le contenu précédent est effacé)
+template<typename N>
+void CheminsDynamiques<N>::construireChemin(unsigned int p_destination, std::vector<unsigned int> & p_chemin) const
+{
+	PRECONDITION(p_destination < m_predecesseur.size());
+	p_chemin.clear();
+	for (unsigned int sommet = p_destination; sommet != AUCUN; sommet = m_predecesseur[sommet])
+		p_chemin.push_back(sommet);
+	std::reverse(p_chemin.begin(), p_chemin.end());
+}
+
+//! \brief		L'arc p_origine -> p_destination a raccourci: seule une amélioration de p_destination peut se propager
+template<typename N>
+void CheminsDynamiques<N>::diminuer(const GrapheCSR<N> & p_arcs, unsigned int p_origine, unsigned int p_destination,
+		const N & p_poids)
+{
+	if (m_distance[p_origine] == std::numeric_limits<N>::max() || !(m_distance[p_origine] + p_poids < m_distance[p_destination]))
+		return;
+	m_distance[p_destination] = m_distance[p_origine] + p_poids;
+	m_predecesseur[p_destination] = p_origine;
+	m_file.insererOuDiminuer(p_destination, m_distance[p_destination]);
+	propager(p_arcs);
+}
+
+//! \brief		L'arc de l'arbre qui menait à p_racine a allongé ou disparu: répare le sous-arbre de p_racine
+template<typename N>
+void CheminsDynamiques<N>::augmenter(const GrapheCSR<N> & p_arcs, const GrapheCSR<N> & p_arcsInverses, unsigned int p_racine)
+{
+	//le sous-arbre: les enfants de x sont les voisins y de x tels que predecesseur[y] == x
+	m_touches.clear();
+	m_touches.push_back(p_racine);
+	m_estTouche[p_racine] = true;
+	for (size_t i = 0; i < m_touches.size(); ++i)
+	{
+		unsigned int sommet = m_touches[i];
+		for (unsigned int k = p_arcs.reqDebut(sommet); k < p_arcs.reqFin(sommet); ++k)
+		{
+			unsigned int enfant = p_arcs.reqDestination(k);
+			if (m_predecesseur[enfant] == sommet && !m_estTouche[enfant])
+			{
+				m_estTouche[enfant] = true;
+				m_touches.push_back(enfant);
+			}
+		}
+	}
+	for (size_t i = 0; i < m_touches.size(); ++i)
+	{
+		m_distance[m_touches[i]] = std::numeric_limits<N>::max();
+		m_predecesseur[m_touches[i]] = AUCUN;
+	}
+
+	//distance provisoire: le meilleur arc entrant venant d'un sommet non touché (dont la distance est exacte)
+	for (size_t i = 0; i < m_touches.size(); ++i)
+	{
+		unsigned int sommet = m_touches[i];
+		for (unsigned int k = p_arcsInverses.reqDebut(sommet); k < p_arcsInverses.reqFin(sommet); ++k)
+		{
+			unsigned int voisin = p_arcsInverses.reqDestination(k);
+			if (m_estTouche[voisin] || m_distance[voisin] == std::numeric_limits<N>::max())
+				continue;
+			N candidat = m_distance[voisin] + p_arcsInverses.reqPoids(k);
+			if (candidat < m_distance[sommet])
+			{
+				m_distance[sommet] = candidat;
+				m_predecesseur[sommet] = voisin;
+			}
+		}
+		if (m_distance[sommet] != std::numeric_limits<N>::max())
+			m_file.insererOuDiminuer(sommet, m_distance[sommet]);
+	}
+	for (size_t i = 0; i < m_touches.size(); ++i)
+		m_estTouche[m_touches[i]] = false;
+
+	//les sommets non touchés ont déjà leur distance exacte: seuls les sommets touchés peuvent s'améliorer
+	propager(p_arcs);
+}
+
+//! \brief		Termine une recherche de Dijkstra à partir des sommets déjà dans la file
+template<typename N>
+void CheminsDynamiques<N>::propager(const GrapheCSR<N> & p_arcs)
+{
+	while (!m_file.estVide())
+	{
+		N distance;
+		unsigned int sommet = m_file.extraireMin(distance);
+		++m_nbSommetsRepares;
+		for (unsigned int k = p_arcs.reqDebut(sommet), fin = p_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = p_arcs.reqDestination(k);
+			N poidsTotalVoisin = distance + p_arcs.reqPoids(k);
+			if (poidsTotalVoisin < m_distance[unVoisin])
+			{
+				m_distance[unVoisin] = poidsTotalVoisin;
+				m_predecesseur[unVoisin] = sommet;
+				m_file.insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+		}
+	}
+}
@@ -0,0 +1,135 @@
+/**
+ * \file   ContexteDense.cpp
+ * \brief  Fichier contenant les noyaux AVX2 de l'algorithme de Dijkstra dense pour des poids de 32 bits
+ *
+ * Le choix entre AVX2 et la boucle scalaire suit celui des noyaux min-plus de Floyd-Warshall
+ * (reqMinPlusAVX2(), fixerMinPlusAVX2()).
+ */
+
+#include "ContexteDense.h"
+#include "FloydWarshall.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CONTEXTEDENSE_X86
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+const unsigned int INFINI = numeric_limits<unsigned int>::max();
+
+#ifdef CONTEXTEDENSE_X86
+/**
+ * \brief Minimum en deux balayages: la plus petite clé, 8 à la fois, puis le premier indice qui la porte
+ */
+__attribute__((target("avx2")))
+unsigned int minimumAVX2(const unsigned int * p_cles, const unsigned int * p_masque, size_t p_nb) {
+	__m256i vMinimum = _mm256_set1_epi32(-1);
+	size_t i = 0;
+	for (; i + 8 <= p_nb; i += 8) {
+		__m256i cle = _mm256_or_si256(_mm256_load_si256(reinterpret_cast<const __m256i *>(p_cles + i)),
+				_mm256_load_si256(reinterpret_cast<const __m256i *>(p_masque + i)));
+		vMinimum = _mm256_min_epu32(vMinimum, cle);
+	}
+	__m128i m = _mm_min_epu32(_mm256_castsi256_si128(vMinimum), _mm256_extracti128_si256(vMinimum, 1));
+	m = _mm_min_epu32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+	m = _mm_min_epu32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+	unsigned int minimum = (unsigned int) _mm_cvtsi128_si32(m);
+	for (size_t j = i; j < p_nb; ++j)
+		minimum = min(minimum, p_cles[j] | p_masque[j]);
+	if (minimum == INFINI)
+		return INFINI;
+
+	const __m256i vCherche = _mm256_set1_epi32((int) minimum);
+	for (i = 0; i + 8 <= p_nb; i += 8) {
+		__m256i cle = _mm256_or_si256(_mm256_load_si256(reinterpret_cast<const __m256i *>(p_cles + i)),
+				_mm256_load_si256(reinterpret_cast<const __m256i *>(p_masque + i)));
+		int egaux = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(cle, vCherche)));
+		if (egaux != 0)
+			return i + __builtin_ctz(egaux);
+	}
+	for (; i < p_nb; ++i)
+		if ((p_cles[i] | p_masque[i]) == minimum)
+			return i;
+	return INFINI;
+}
+
+/**
+ * \brief Relaxation 8 sommets à la fois: la nouvelle clé est le minimum non signé, et un sommet
+ *        est amélioré là où ce minimum diffère de l'ancienne clé et où le masque est nul
+ * \note la rangée de la matrice n'est pas forcément alignée (elle commence à i * n)
+ */
+__attribute__((target("avx2")))
+void relaxerAVX2(unsigned int * p_cles, unsigned int * p_predecesseurs, const unsigned int * p_masque,
+		const unsigned int * p_rangee, size_t p_nb, unsigned int p_distance, unsigned int p_sommet) {
+	const unsigned int limite = INFINI - p_distance;
+	const __m256i vDistance = _mm256_set1_epi32((int) p_distance);
+	const __m256i vLimite = _mm256_set1_epi32((int) limite);
+	const __m256i vSommet = _mm256_set1_epi32((int) p_sommet);
+	size_t i = 0;
+	for (; i + 8 <= p_nb; i += 8) {
+		__m256i poids = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p_rangee + i));
+		__m256i cle = _mm256_load_si256(reinterpret_cast<const __m256i *>(p_cles + i));
+		__m256i masque = _mm256_load_si256(reinterpret_cast<const __m256i *>(p_masque + i));
+		__m256i candidat = _mm256_min_epu32(_mm256_add_epi32(vDistance, _mm256_min_epu32(poids, vLimite)), cle);
+		__m256i inchange = _mm256_or_si256(_mm256_cmpeq_epi32(candidat, cle), masque);
+		if (_mm256_movemask_epi8(inchange) == -1)
+			continue;
+		__m256i * predecesseurs = reinterpret_cast<__m256i *>(p_predecesseurs + i);
+		_mm256_store_si256(reinterpret_cast<__m256i *>(p_cles + i), _mm256_blendv_epi8(candidat, cle, inchange));
+		_mm256_store_si256(predecesseurs, _mm256_blendv_epi8(vSommet, _mm256_load_si256(predecesseurs), inchange));
+	}
+	for (; i < p_nb; ++i) {
+		unsigned int candidat = p_distance + min(p_rangee[i], limite);
+		if (p_masque[i] == 0 && candidat < p_cles[i]) {
+			p_cles[i] = candidat;
+			p_predecesseurs[i] = p_sommet;
+		}
+	}
+}
+#endif
+
+}
+
+/**
+ * \brief Indice de la plus petite clé non masquée (la première en cas d'égalité), pour des poids de 32 bits
+ * \pre les trois tableaux de ContexteDense sont alignés sur 32 octets
+ */
+unsigned int minimumDense(const unsigned int * p_cles, const unsigned int * p_masque, size_t p_nb) {
+#ifdef CONTEXTEDENSE_X86
+	if (reqMinPlusAVX2())
+		return minimumAVX2(p_cles, p_masque, p_nb);
+#endif
+	unsigned int minimum = INFINI;
+	unsigned int sommet = INFINI;
+	for (size_t i = 0; i < p_nb; ++i) {
+		unsigned int cle = p_cles[i] | p_masque[i];
+		if (cle < minimum) {
+			minimum = cle;
+			sommet = i;
+		}
+	}
+	return sommet;
+}
+
+/**
+ * \brief Relaxe la rangée d'un sommet à distance p_distance, pour des poids de 32 bits
+ */
+void relaxerDense(unsigned int * p_cles, unsigned int * p_predecesseurs, const unsigned int * p_masque,
+		const unsigned int * p_rangee, size_t p_nb, unsigned int p_distance, unsigned int p_sommet) {
+#ifdef CONTEXTEDENSE_X86
+	if (reqMinPlusAVX2()) {
+		relaxerAVX2(p_cles, p_predecesseurs, p_masque, p_rangee, p_nb, p_distance, p_sommet);
+		return;
+	}
+#endif
+	const unsigned int limite = INFINI - p_distance;
+	for (size_t i = 0; i < p_nb; ++i) {
+		unsigned int candidat = p_distance + min(p_rangee[i], limite);
+		bool meilleur = p_masque[i] == 0 && candidat < p_cles[i];
+		p_cles[i] = meilleur ? candidat : p_cles[i];
+		p_predecesseurs[i] = meilleur ? p_sommet : p_predecesseurs[i];
+	}
+}
@@ -0,0 +1,62 @@
+//
+//  ContexteDense.h
+//  espace de travail et noyaux de l'algorithme de Dijkstra en O(n^2) sur la matrice d'adjacence
+//
+
+#ifndef CONTEXTEDENSE_H
+#define CONTEXTEDENSE_H
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+#include "ContratException.h"
+#include "AllocateurAligne.h"
+
+//! \brief Patron de classe regroupant les tableaux plats et alignés d'une recherche de Dijkstra dense
+//! \brief chaque sommet a une clé (sa distance provisoire, puis finale), un prédécesseur et un masque:
+//! \brief 0 tant qu'il n'est pas solutionné, ~0 ensuite. Le minimum est cherché sur clé | masque, de sorte
+//! \brief qu'un sommet solutionné vaut la sentinelle numeric_limits<N>::max() sans que sa clé soit perdue,
+//! \brief et la relaxation n'écrit que là où le masque est nul. Il n'y a ni liste ni branchement par sommet:
+//! \brief une itération est un balayage des clés suivi d'un balayage d'une rangée de la matrice.
+//! \brief un contexte ne doit servir qu'à une recherche à la fois (un contexte par fil d'exécution)
+//! \brief N est le type pour les poids (non signé)
+template <typename N>
+class ContexteDense
+{
+public:
+	typedef std::vector<N, AllocateurAligne<N> > tableauCles;
+	typedef std::vector<unsigned int, AllocateurAligne<unsigned int> > tableauEntiers;
+
+	ContexteDense();
+
+	void preparer(size_t p_nbSommets, unsigned int p_origine);
+
+	size_t reqNbSommets() const;
+	N reqDistance(unsigned int p_sommet) const;
+	unsigned int reqPredecesseur(unsigned int p_sommet) const;
+	bool estSolutionne(unsigned int p_sommet) const;
+
+	unsigned int solutionnerMinimum(N & p_distance);
+	void relaxer(unsigned int p_sommet, const N * p_rangee);
+
+private:
+	tableauCles m_cles;             /*!< distances provisoires, finales une fois le sommet solutionné */
+	tableauEntiers m_predecesseurs;
+	tableauEntiers m_masque;        /*!< ~0 pour un sommet solutionné, 0 sinon */
+};
+
+template <typename N>
+unsigned int minimumDense(const N * p_cles, const unsigned int * p_masque, size_t p_nb);
+template <typename N>
+void relaxerDense(N * p_cles, unsigned int * p_predecesseurs, const unsigned int * p_masque, const N * p_rangee,
+		size_t p_nb, N p_distance, unsigned int p_sommet);
+
+unsigned int minimumDense(const unsigned int * p_cles, const unsigned int * p_masque, size_t p_nb);
+void relaxerDense(unsigned int * p_cles, unsigned int * p_predecesseurs, const unsigned int * p_masque,
+		const unsigned int * p_rangee, size_t p_nb, unsigned int p_distance, unsigned int p_sommet);
+
+
+#include "ContexteDense.hpp"
+
+#endif
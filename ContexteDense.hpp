@@ -0,0 +1,120 @@
+//
+//  ContexteDense.hpp
+//  espace de travail et noyaux de l'algorithme de Dijkstra en O(n^2) sur la matrice d'adjacence
+//
+
+#include <algorithm>
+
+#include "ContexteDense.h"
+
+//! \brief		Constructeur sans paramètre
+//! \post		Un contexte vide est créé; preparer() doit être appelé avant chaque recherche
+template<typename N>
+ContexteDense<N>::ContexteDense()
+{
+}
+
+//! \brief		Prépare le contexte pour une recherche depuis p_origine sur un graphe de p_nbSommets sommets
+//! \brief		les tableaux ne sont réalloués que si la taille du graphe change, mais ils sont remis à
+//! \brief		zéro à chaque recherche: ce balayage est du même ordre qu'une seule itération de la recherche
+//! \post		seule p_origine est atteinte (à distance 0) et aucun sommet n'est solutionné
+template<typename N>
+void ContexteDense<N>::preparer(size_t p_nbSommets, unsigned int p_origine)
+{
+	PRECONDITION(p_origine < p_nbSommets);
+	m_cles.assign(p_nbSommets, std::numeric_limits<N>::max());
+	m_predecesseurs.assign(p_nbSommets, std::numeric_limits<unsigned int>::max());
+	m_masque.assign(p_nbSommets, 0);
+	m_cles[p_origine] = 0;
+}
+
+template<typename N>
+size_t ContexteDense<N>::reqNbSommets() const
+{
+	return m_cles.size();
+}
+
+//! \brief		Obtient la distance provisoire (ou finale) du sommet
+//! \return		numeric_limits<N>::max() si le sommet n'a pas été atteint
+template<typename N>
+N ContexteDense<N>::reqDistance(unsigned int p_sommet) const
+{
+	return m_cles[p_sommet];
+}
+
+//! \brief		Obtient le prédécesseur du sommet
+//! \return		numeric_limits<unsigned int>::max() si le sommet n'a pas de prédécesseur
+template<typename N>
+unsigned int ContexteDense<N>::reqPredecesseur(unsigned int p_sommet) const
+{
+	return m_predecesseurs[p_sommet];
+}
+
+template<typename N>
+bool ContexteDense<N>::estSolutionne(unsigned int p_sommet) const
+{
+	return m_masque[p_sommet] != 0;
+}
+
+//! \brief		Solutionne le sommet atteint non solutionné de plus petite clé (le premier en cas d'égalité)
+//! \param[out]	p_distance la distance finale de ce sommet
+//! \return		le sommet solutionné, ou numeric_limits<unsigned int>::max() s'il ne reste aucun sommet atteint
+template<typename N>
+unsigned int ContexteDense<N>::solutionnerMinimum(N & p_distance)
+{
+	unsigned int sommet = minimumDense(m_cles.data(), m_masque.data(), m_cles.size());
+	if (sommet != std::numeric_limits<unsigned int>::max())
+	{
+		p_distance = m_cles[sommet];
+		m_masque[sommet] = ~0u;
+	}
+	return sommet;
+}
+
+//! \brief		Relaxe tous les arcs d'un sommet solutionné
+//! \param[in]	p_rangee la rangée du sommet dans la matrice d'adjacence (max() sans arc)
+template<typename N>
+void ContexteDense<N>::relaxer(unsigned int p_sommet, const N * p_rangee)
+{
+	PRECONDITION(estSolutionne(p_sommet));
+	relaxerDense(m_cles.data(), m_predecesseurs.data(), m_masque.data(), p_rangee, m_cles.size(),
+			m_cles[p_sommet], p_sommet);
+}
+
+//! \brief		Indice de la plus petite clé non masquée (la première en cas d'égalité), version générique
+//! \return		numeric_limits<unsigned int>::max() si toutes les clés non masquées valent max()
+template<typename N>
+unsigned int minimumDense(const N * p_cles, const unsigned int * p_masque, size_t p_nb)
+{
+	const N infini = std::numeric_limits<N>::max();
+	N minimum = infini;
+	unsigned int sommet = std::numeric_limits<unsigned int>::max();
+	for (size_t i = 0; i < p_nb; ++i)
+	{
+		N cle = p_masque[i] != 0 ? infini : p_cles[i];
+		if (cle < minimum)
+		{
+			minimum = cle;
+			sommet = i;
+		}
+	}
+	return sommet;
+}
+
+//! \brief		Relaxe la rangée d'un sommet à distance p_distance, version générique
+//! \brief		l'addition sature à max(): un arc absent (max()) ne peut rien améliorer
+template<typename N>
+void relaxerDense(N * p_cles, unsigned int * p_predecesseurs, const unsigned int * p_masque, const N * p_rangee,
+		size_t p_nb, N p_distance, unsigned int p_sommet)
+{
+	const N limite = std::numeric_limits<N>::max() - p_distance;
+	for (size_t i = 0; i < p_nb; ++i)
+	{
+		N candidat = p_distance + std::min(p_rangee[i], limite);
+		if (p_masque[i] == 0 && candidat < p_cles[i])
+		{
+			p_cles[i] = candidat;
+			p_predecesseurs[i] = p_sommet;
+		}
+	}
+}
@@ -0,0 +1,81 @@
+//
+//  ContextePareto.h
+//  espace de travail réutilisable pour les recherches multicritères (durée, correspondances)
+//
+
+#ifndef CONTEXTEPARETO_H
+#define CONTEXTEPARETO_H
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+#include "ContratException.h"
+
+//! \brief Patron de classe regroupant les tableaux de travail d'une recherche d'étiquettes multicritère
+//! \brief Une étiquette est un chemin partiel résumé par (durée, correspondances); elles sont rangées dans
+//! \brief une réserve contiguë qui garde sa capacité d'une recherche à l'autre et se référencent par index.
+//! \brief Le sac d'un sommet (ses étiquettes non dominées) occupe une tranche fixe de reqMaxEtiquettes()
+//! \brief cases d'un seul tableau; les tailles des sacs sont réinitialisées paresseusement par génération,
+//! \brief comme dans ContexteRecherche. La file est un tas binaire ordonné par (durée, correspondances).
+//! \brief un contexte ne doit servir qu'à une recherche à la fois (un contexte par fil d'exécution)
+//! \brief N est le type pour les durées
+template <typename N>
+class ContextePareto
+{
+public:
+	//! \brief un chemin partiel; parent est l'index de l'étiquette précédente (AUCUNE à l'origine)
+	struct etiquette
+	{
+		N duree;
+		unsigned int correspondances;
+		unsigned int sommet;
+		unsigned int parent;
+		bool dominee;
+	};
+
+	static const unsigned int AUCUNE = std::numeric_limits<unsigned int>::max();
+
+	ContextePareto();
+
+	void preparer(size_t p_nbSommets, unsigned int p_maxEtiquettes);
+
+	unsigned int creer(N p_duree, unsigned int p_correspondances, unsigned int p_sommet, unsigned int p_parent);
+	const etiquette & reqEtiquette(unsigned int p_index) const;
+	size_t reqNbEtiquettesCreees() const;
+
+	bool estDominee(unsigned int p_sommet, N p_duree, unsigned int p_correspondances) const;
+	bool ajouter(unsigned int p_index);
+	unsigned int reqTailleSac(unsigned int p_sommet) const;
+	unsigned int reqDuSac(unsigned int p_sommet, unsigned int p_rang) const;
+	unsigned int reqMaxEtiquettes() const;
+
+	bool estVide() const;
+	unsigned int extraireMin();
+
+private:
+	//! \brief entrée du tas: la clé est copiée pour que les comparaisons restent dans le tas
+	struct entree
+	{
+		N duree;
+		unsigned int correspondances;
+		unsigned int index;
+		bool operator>(const entree & p_autre) const
+		{
+			return p_autre.duree < duree || (!(duree < p_autre.duree) && p_autre.correspondances < correspondances);
+		}
+	};
+
+	std::vector<etiquette> m_etiquettes;          /*!< la réserve d'étiquettes de la recherche courante */
+	std::vector<unsigned int> m_sacs;             /*!< reqMaxEtiquettes() cases par sommet */
+	std::vector<unsigned int> m_tailles;          /*!< nombre d'étiquettes du sac de chaque sommet */
+	std::vector<unsigned int> m_generationSommet; /*!< génération de la dernière écriture de chaque sac */
+	unsigned int m_generation;
+	unsigned int m_maxEtiquettes;
+	std::vector<entree> m_tas;
+};
+
+
+#include "ContextePareto.hpp"
+
+#endif
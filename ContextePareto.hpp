@@ -0,0 +1,189 @@
+//
+//  ContextePareto.hpp
+//  espace de travail réutilisable pour les recherches multicritères (durée, correspondances)
+//
+
+#include <algorithm>
+#include <functional>
+
+#include "ContextePareto.h"
+
+template<typename N>
+const unsigned int ContextePareto<N>::AUCUNE;
+
+//! \brief		Constructeur sans paramètre
+//! \post		Un contexte vide est créé; preparer() doit être appelé avant chaque recherche
+template<typename N>
+ContextePareto<N>::ContextePareto() : m_generation(0), m_maxEtiquettes(0)
+{
+}
+
+//! \brief		Prépare le contexte pour une nouvelle recherche sur un graphe de p_nbSommets sommets
+//! \param[in]	p_maxEtiquettes le nombre maximal d'étiquettes gardées par sommet
+//! \post		tous les sacs sont vides, la réserve et la file aussi (leur capacité est conservée)
+template<typename N>
+void ContextePareto<N>::preparer(size_t p_nbSommets, unsigned int p_maxEtiquettes)
+{
+	PRECONDITION(p_maxEtiquettes > 0);
+	if (p_nbSommets != m_tailles.size() || p_maxEtiquettes != m_maxEtiquettes)
+	{
+		m_sacs.resize(p_nbSommets * p_maxEtiquettes);
+		m_tailles.resize(p_nbSommets);
+		m_generationSommet.assign(p_nbSommets, 0);
+		m_generation = 0;
+		m_maxEtiquettes = p_maxEtiquettes;
+	}
+	m_etiquettes.clear();
+	m_tas.clear();
+
+	++m_generation;
+	if (m_generation == 0)
+	{
+		//débordement du compteur: on efface les générations une fois tous les 2^32 appels
+		m_generationSommet.assign(p_nbSommets, 0);
+		m_generation = 1;
+	}
+}
+
+//! \brief		Crée une étiquette dans la réserve et la place dans la file
+//! \return		l'index de l'étiquette
+template<typename N>
+unsigned int ContextePareto<N>::creer(N p_duree, unsigned int p_correspondances, unsigned int p_sommet, unsigned int p_parent)
+{
+	etiquette e;
+	e.duree = p_duree;
+	e.correspondances = p_correspondances;
+	e.sommet = p_sommet;
+	e.parent = p_parent;
+	e.dominee = false;
+	m_etiquettes.push_back(e);
+
+	entree a;
+	a.duree = p_duree;
+	a.correspondances = p_correspondances;
+	a.index = m_etiquettes.size() - 1;
+	m_tas.push_back(a);
+	std::push_heap(m_tas.begin(), m_tas.end(), std::greater<entree>());
+	return a.index;
+}
+
+//! \brief		Obtient une étiquette de la réserve
+template<typename N>
+const typename ContextePareto<N>::etiquette & ContextePareto<N>::reqEtiquette(unsigned int p_index) const
+{
+	PRECONDITION(p_index < m_etiquettes.size());
+	return m_etiquettes[p_index];
+}
+
+//! \brief		Obtient le nombre d'étiquettes créées depuis preparer()
+template<typename N>
+size_t ContextePareto<N>::reqNbEtiquettesCreees() const
+{
+	return m_etiquettes.size();
+}
+
+//! \brief		Indique si une étiquette du sac de p_sommet est au moins aussi bonne sur les deux critères
+template<typename N>
+bool ContextePareto<N>::estDominee(unsigned int p_sommet, N p_duree, unsigned int p_correspondances) const
+{
+	const unsigned int * sac = &m_sacs[(size_t) p_sommet * m_maxEtiquettes];
+	for (unsigned int i = 0, taille = reqTailleSac(p_sommet); i < taille; ++i)
+	{
+		const etiquette & e = m_etiquettes[sac[i]];
+		if (!(p_duree < e.duree) && !(p_correspondances < e.correspondances))
+			return true;
+	}
+	return false;
+}
+
+//! \brief		Ajoute une étiquette non dominée au sac de son sommet
+//! \brief		les étiquettes qu'elle domine sont retirées du sac et marquées, et seront ignorées par la file
+//! \brief		un sac plein ne garde l'étiquette que si elle est plus rapide que la plus lente du sac, qu'elle remplace:
+//! \brief		le chemin le plus rapide n'est jamais perdu
+//! \return		faux si l'étiquette est abandonnée (elle est alors marquée dominée)
+//! \pre		l'étiquette n'est dominée par aucune étiquette du sac (estDominee() est faux)
+template<typename N>
+bool ContextePareto<N>::ajouter(unsigned int p_index)
+{
+	PRECONDITION(p_index < m_etiquettes.size());
+	etiquette & nouvelle = m_etiquettes[p_index];
+	const unsigned int sommet = nouvelle.sommet;
+	if (m_generationSommet[sommet] != m_generation)
+	{
+		m_generationSommet[sommet] = m_generation;
+		m_tailles[sommet] = 0;
+	}
+
+	unsigned int * sac = &m_sacs[(size_t) sommet * m_maxEtiquettes];
+	unsigned int taille = 0;
+	for (unsigned int i = 0; i < m_tailles[sommet]; ++i)
+	{
+		etiquette & e = m_etiquettes[sac[i]];
+		if (!(e.duree < nouvelle.duree) && !(e.correspondances < nouvelle.correspondances))
+			e.dominee = true;
+		else
+			sac[taille++] = sac[i];
+	}
+	m_tailles[sommet] = taille;
+	if (taille < m_maxEtiquettes)
+	{
+		sac[m_tailles[sommet]++] = p_index;
+		return true;
+	}
+
+	//sac plein: la nouvelle étiquette ne remplace la plus lente que si elle est plus rapide
+	unsigned int plusLente = 0;
+	for (unsigned int i = 1; i < taille; ++i)
+		if (m_etiquettes[sac[plusLente]].duree < m_etiquettes[sac[i]].duree)
+			plusLente = i;
+	if (!(nouvelle.duree < m_etiquettes[sac[plusLente]].duree))
+	{
+		nouvelle.dominee = true;
+		return false;
+	}
+	m_etiquettes[sac[plusLente]].dominee = true;
+	sac[plusLente] = p_index;
+	return true;
+}
+
+//! \brief		Obtient le nombre d'étiquettes du sac de p_sommet
+template<typename N>
+unsigned int ContextePareto<N>::reqTailleSac(unsigned int p_sommet) const
+{
+	return m_generationSommet[p_sommet] == m_generation ? m_tailles[p_sommet] : 0;
+}
+
+//! \brief		Obtient l'index de l'étiquette de rang p_rang dans le sac de p_sommet
+template<typename N>
+unsigned int ContextePareto<N>::reqDuSac(unsigned int p_sommet, unsigned int p_rang) const
+{
+	PRECONDITION(p_rang < reqTailleSac(p_sommet));
+	return m_sacs[(size_t) p_sommet * m_maxEtiquettes + p_rang];
+}
+
+//! \brief		Obtient le nombre maximal d'étiquettes par sommet
+template<typename N>
+unsigned int ContextePareto<N>::reqMaxEtiquettes() const
+{
+	return m_maxEtiquettes;
+}
+
+//! \brief		Indique si la file ne contient plus aucune étiquette
+template<typename N>
+bool ContextePareto<N>::estVide() const
+{
+	return m_tas.empty();
+}
+
+//! \brief		Retire de la file l'étiquette de plus petite (durée, correspondances)
+//! \return		son index; elle peut avoir été dominée depuis sa création (voir reqEtiquette().dominee)
+//! \pre		la file ne doit pas être vide
+template<typename N>
+unsigned int ContextePareto<N>::extraireMin()
+{
+	PRECONDITION(!estVide());
+	std::pop_heap(m_tas.begin(), m_tas.end(), std::greater<entree>());
+	unsigned int index = m_tas.back().index;
+	m_tas.pop_back();
+	return index;
+}
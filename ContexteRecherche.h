@@ -0,0 +1,52 @@
+//
+//  ContexteRecherche.h
+//  espace de travail réutilisable pour les recherches de plus court chemin
+//
+
+#ifndef CONTEXTERECHERCHE_H
+#define CONTEXTERECHERCHE_H
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+#include "ContratException.h"
+#include "FilePriorite.h"
+
+//! \brief Patron de classe regroupant les tableaux de travail d'une recherche de Dijkstra
+//! \brief les distances et prédécesseurs sont réinitialisés paresseusement: chaque sommet porte
+//! \brief le numéro de génération de sa dernière écriture, et une nouvelle recherche ne fait
+//! \brief qu'incrémenter la génération courante au lieu d'effacer les n cases
+//! \brief un contexte ne doit servir qu'à une recherche à la fois (un contexte par fil d'exécution)
+//! \brief N est le type pour les poids, FilePriorite la politique de file de priorité
+template <typename N, typename FilePriorite = TasDAire<N> >
+class ContexteRecherche
+{
+public:
+	ContexteRecherche();
+
+	void preparer(size_t p_nbSommets, const N & p_poidsMax);
+
+	N reqDistance(unsigned int p_sommet) const;
+	unsigned int reqPredecesseur(unsigned int p_sommet) const;
+	bool estAtteint(unsigned int p_sommet) const;
+	void fixer(unsigned int p_sommet, const N & p_distance, unsigned int p_predecesseur);
+
+	size_t reqNbSommets() const;
+	FilePriorite & reqFile();
+
+	void exporter(std::vector<N> & p_distance, std::vector<unsigned int> & p_predecesseur) const;
+
+private:
+	std::vector<N> m_distance;
+	std::vector<unsigned int> m_predecesseur;
+	std::vector<unsigned int> m_generationSommet; /*!< génération de la dernière écriture de chaque sommet */
+	unsigned int m_generation;                    /*!< génération de la recherche en cours */
+	N m_poidsMax;                                 /*!< poids maximal pour lequel la file a été initialisée */
+	FilePriorite m_file;
+};
+
+
+#include "ContexteRecherche.hpp"
+
+#endif
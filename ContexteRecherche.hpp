@@ -0,0 +1,104 @@
+//
+//  ContexteRecherche.hpp
+//  espace de travail réutilisable pour les recherches de plus court chemin
+//
+
+#include "ContexteRecherche.h"
+
+//! \brief		Constructeur sans paramètre
+//! \post		Un contexte vide est créé; preparer() doit être appelé avant chaque recherche
+template<typename N, typename FilePriorite>
+ContexteRecherche<N,FilePriorite>::ContexteRecherche() : m_generation(0), m_poidsMax(0)
+{
+}
+
+//! \brief		Prépare le contexte pour une nouvelle recherche sur un graphe de p_nbSommets sommets
+//! \brief		les tableaux ne sont (ré)alloués que si la taille du graphe ou le poids maximal change;
+//! \brief		sinon, seule la génération courante est incrémentée et la file est vidée
+//! \post		tous les sommets sont à une distance infinie et sans prédécesseur
+template<typename N, typename FilePriorite>
+void ContexteRecherche<N,FilePriorite>::preparer(size_t p_nbSommets, const N & p_poidsMax)
+{
+	if (p_nbSommets != m_distance.size() || p_poidsMax != m_poidsMax)
+	{
+		m_distance.resize(p_nbSommets);
+		m_predecesseur.resize(p_nbSommets);
+		m_generationSommet.assign(p_nbSommets, 0);
+		m_generation = 0;
+		m_poidsMax = p_poidsMax;
+		m_file.initialiser(p_nbSommets, p_poidsMax);
+	}
+	else
+	{
+		m_file.vider();
+	}
+
+	++m_generation;
+	if (m_generation == 0)
+	{
+		//débordement du compteur: on efface les générations une fois tous les 2^32 appels
+		m_generationSommet.assign(p_nbSommets, 0);
+		m_generation = 1;
+	}
+}
+
+//! \brief		Obtient la distance provisoire (ou finale) du sommet
+//! \return		numeric_limits<N>::max() si le sommet n'a pas été atteint par la recherche courante
+template<typename N, typename FilePriorite>
+N ContexteRecherche<N,FilePriorite>::reqDistance(unsigned int p_sommet) const
+{
+	return m_generationSommet[p_sommet] == m_generation ? m_distance[p_sommet] : std::numeric_limits<N>::max();
+}
+
+//! \brief		Obtient le prédécesseur du sommet
+//! \return		numeric_limits<unsigned int>::max() si le sommet n'a pas de prédécesseur
+template<typename N, typename FilePriorite>
+unsigned int ContexteRecherche<N,FilePriorite>::reqPredecesseur(unsigned int p_sommet) const
+{
+	return m_generationSommet[p_sommet] == m_generation ? m_predecesseur[p_sommet] : std::numeric_limits<unsigned int>::max();
+}
+
+//! \brief		Indique si le sommet a reçu une distance lors de la recherche courante
+template<typename N, typename FilePriorite>
+bool ContexteRecherche<N,FilePriorite>::estAtteint(unsigned int p_sommet) const
+{
+	return m_generationSommet[p_sommet] == m_generation;
+}
+
+//! \brief		Fixe la distance et le prédécesseur du sommet pour la recherche courante
+template<typename N, typename FilePriorite>
+void ContexteRecherche<N,FilePriorite>::fixer(unsigned int p_sommet, const N & p_distance, unsigned int p_predecesseur)
+{
+	m_generationSommet[p_sommet] = m_generation;
+	m_distance[p_sommet] = p_distance;
+	m_predecesseur[p_sommet] = p_predecesseur;
+}
+
+//! \brief		Obtient le nombre de sommets pour lequel le contexte est préparé
+template<typename N, typename FilePriorite>
+size_t ContexteRecherche<N,FilePriorite>::reqNbSommets() const
+{
+	return m_distance.size();
+}
+
+//! \brief		Obtient la file de priorité de la recherche
+template<typename N, typename FilePriorite>
+FilePriorite & ContexteRecherche<N,FilePriorite>::reqFile()
+{
+	return m_file;
+}
+
+//! \brief		Copie les distances et prédécesseurs de la recherche courante dans des vecteurs pleins
+//! \param[out]	p_distance la distance de chaque sommet (numeric_limits<N>::max() si non atteint)
+//! \param[out]	p_predecesseur le prédécesseur de chaque sommet (numeric_limits<unsigned int>::max() si aucun)
+template<typename N, typename FilePriorite>
+void ContexteRecherche<N,FilePriorite>::exporter(std::vector<N> & p_distance, std::vector<unsigned int> & p_predecesseur) const
+{
+	p_distance.resize(m_distance.size());
+	p_predecesseur.resize(m_distance.size());
+	for (unsigned int i = 0; i < m_distance.size(); ++i)
+	{
+		p_distance[i] = reqDistance(i);
+		p_predecesseur[i] = reqPredecesseur(i);
+	}
+}
@@ -0,0 +1,59 @@
+/**
+ * \file   FichierProjete.cpp
+ * \brief  Fichier contenant l'implémentation de la classe FichierProjete
+ */
+
+#include "FichierProjete.h"
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+/**
+ * \brief Projette en mémoire tout le fichier p_nomFichier
+ * \post en cas d'erreur (fichier absent, illisible), une exception est levée
+ */
+FichierProjete::FichierProjete(const string & p_nomFichier) :
+		m_donnees(0), m_taille(0) {
+	int descripteur = open(p_nomFichier.c_str(), O_RDONLY);
+	if (descripteur < 0)
+		throw logic_error("FichierProjete: impossible d'ouvrir " + p_nomFichier);
+
+	struct stat etat;
+	if (fstat(descripteur, &etat) != 0) {
+		close(descripteur);
+		throw logic_error("FichierProjete: impossible de lire la taille de " + p_nomFichier);
+	}
+	m_taille = etat.st_size;
+
+	if (m_taille > 0) {
+		void * adresse = mmap(0, m_taille, PROT_READ, MAP_PRIVATE, descripteur, 0);
+		if (adresse == MAP_FAILED) {
+			close(descripteur);
+			throw logic_error("FichierProjete: impossible de projeter " + p_nomFichier);
+		}
+		m_donnees = static_cast<const char *>(adresse);
+	}
+	//la projection reste valide après la fermeture du descripteur
+	close(descripteur);
+}
+
+FichierProjete::~FichierProjete() {
+	if (m_donnees != 0)
+		munmap(const_cast<char *>(m_donnees), m_taille);
+}
+
+/**
+ * \brief Obtient le début du fichier en mémoire (0 si le fichier est vide)
+ */
+const char * FichierProjete::reqDonnees() const {
+	return m_donnees;
+}
+
+size_t FichierProjete::reqTaille() const {
+	return m_taille;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file   FichierProjete.h
+ * \brief  Fichier contenant la déclaration de la classe FichierProjete
+ */
+
+#ifndef FICHIERPROJETE_H
+#define FICHIERPROJETE_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * \class FichierProjete
+ * \brief Projection en mémoire (mmap) d'un fichier complet, en lecture seule.
+ *
+ * Les pages sont chargées par le système à la demande et partagées entre les processus
+ * qui lisent le même fichier. La projection est retirée à la destruction de l'objet;
+ * l'objet n'est pas copiable.
+ */
+class FichierProjete
+{
+public:
+	explicit FichierProjete(const std::string & p_nomFichier);
+	~FichierProjete();
+
+	const char * reqDonnees() const;
+	size_t reqTaille() const;
+
+private:
+	FichierProjete(const FichierProjete &);
+	FichierProjete & operator=(const FichierProjete &);
+
+	const char * m_donnees;
+	size_t m_taille;
+};
+
+#endif
@@ -0,0 +1,163 @@
+//
+//  FilePriorite.h
+//  politiques de file de priorité pour les algorithmes de plus court chemin
+//
+//  Toutes les politiques offrent la même interface:
+//    initialiser(n, poidsMax)        prépare une file vide pour des sommets 0..n-1
+//    estVide()                       vrai si aucun sommet n'est en attente
+//    reqTaille()                     nombre de sommets en attente
+//    insererOuDiminuer(sommet, cle)  insère le sommet ou diminue sa clé (ignoré si la clé n'est pas plus petite)
+//    extraireMin(cle)                retire et retourne le sommet de clé minimale
+//    vider()                         retire tous les sommets en attente, en temps proportionnel à leur nombre
+//    nom()                           nom de la politique, pour les mesures de performance
+//
+
+#ifndef FILEPRIORITE_H
+#define FILEPRIORITE_H
+
+#include <vector>
+#include <set>
+#include <utility>
+#include <limits>
+#include <cstddef>
+
+#include "ContratException.h"
+
+
+//! \brief File de priorité basée sur std::set (l'implémentation d'origine de DijkstraCalculerChemins)
+//! \brief chaque diminution de clé est un retrait suivi d'une insertion
+//! \brief les égalités sont départagées par le plus petit numéro de sommet
+template <typename N>
+class FileEnsemble
+{
+public:
+	FileEnsemble();
+
+	void initialiser(size_t p_nbSommets, const N & p_poidsMax);
+	bool estVide() const;
+	size_t reqTaille() const;
+	void insererOuDiminuer(unsigned int p_sommet, const N & p_cle);
+	unsigned int extraireMin(N & p_cle);
+	void vider();
+
+	static const char * nom();
+
+private:
+	std::set< std::pair<N, unsigned int> > m_ensemble;
+	std::vector<N> m_cle;  /*!< clé courante de chaque sommet en attente */
+};
+
+
+//! \brief Tas d-aire indexé avec diminution de clé en place
+//! \brief la position de chaque sommet dans le tas est conservée, ce qui évite les doublons
+//! \brief les égalités sont départagées par le plus petit numéro de sommet, comme FileEnsemble
+//! \brief D est le nombre d'enfants par noeud (4 par défaut)
+template <typename N, unsigned int D = 4>
+class TasDAire
+{
+public:
+	TasDAire();
+
+	void initialiser(size_t p_nbSommets, const N & p_poidsMax);
+	bool estVide() const;
+	size_t reqTaille() const;
+	void insererOuDiminuer(unsigned int p_sommet, const N & p_cle);
+	unsigned int extraireMin(N & p_cle);
+	void vider();
+
+	static const char * nom();
+
+private:
+	struct element
+	{
+		N cle;
+		unsigned int sommet;
+	};
+
+	static bool precede(const element & a, const element & b);
+	void monter(unsigned int p_index);
+	void descendre(unsigned int p_index);
+
+	std::vector<element> m_tas;
+	std::vector<unsigned int> m_position;  /*!< index de chaque sommet dans m_tas, ABSENT sinon */
+
+	static const unsigned int ABSENT = std::numeric_limits<unsigned int>::max();
+};
+
+
+//! \brief Tas radix (radix heap) pour des clés entières non signées
+//! \brief les clés extraites doivent être non décroissantes (vrai pour Dijkstra avec des poids positifs)
+//! \brief une diminution de clé insère un nouvel élément; l'ancien est ignoré à la redistribution
+template <typename N>
+class TasRadix
+{
+public:
+	TasRadix();
+
+	void initialiser(size_t p_nbSommets, const N & p_poidsMax);
+	bool estVide() const;
+	size_t reqTaille() const;
+	void insererOuDiminuer(unsigned int p_sommet, const N & p_cle);
+	unsigned int extraireMin(N & p_cle);
+	void vider();
+
+	static const char * nom();
+
+private:
+	static unsigned int indiceSeau(const N & p_cle, const N & p_dernier);
+	bool estAJour(const std::pair<N, unsigned int> & p_element) const;
+
+	static const unsigned int NB_SEAUX = std::numeric_limits<N>::digits + 1;
+
+	std::vector< std::pair<N, unsigned int> > m_seaux[NB_SEAUX];
+	N m_dernier;                    /*!< dernière clé extraite */
+	size_t m_taille;                /*!< nombre de sommets en attente */
+	std::vector<N> m_cle;           /*!< clé courante de chaque sommet */
+	std::vector<bool> m_enAttente;  /*!< vrai si le sommet est dans la file */
+};
+
+
+//! \brief File à seaux de Dial pour de petits poids entiers
+//! \brief p_poidsMax + 1 seaux circulaires; chaque seau est une liste doublement chaînée intrusive
+//! \brief la diminution de clé déplace le sommet d'un seau à l'autre en temps constant
+//! \pre les clés extraites doivent être non décroissantes et aucune clé en attente
+//!      ne doit dépasser la dernière clé extraite de plus de p_poidsMax
+//! \note contrairement aux autres politiques, la mémoire croît avec p_poidsMax: elle ne convient pas
+//!      aux clés composées (par exemple la clé lexicographique de Graphe::dijkstraCorrespondances())
+template <typename N>
+class FileDial
+{
+public:
+	FileDial();
+
+	void initialiser(size_t p_nbSommets, const N & p_poidsMax);
+	bool estVide() const;
+	size_t reqTaille() const;
+	void insererOuDiminuer(unsigned int p_sommet, const N & p_cle);
+	unsigned int extraireMin(N & p_cle);
+	void vider();
+
+	static const char * nom();
+
+private:
+	void retirer(unsigned int p_sommet);
+	void occuper(size_t p_seau);
+	void liberer(size_t p_seau);
+
+	std::vector<unsigned int> m_tetes;      /*!< premier sommet de chaque seau */
+	std::vector<size_t> m_occupes;          /*!< les seaux non vides, dans le désordre: vider() ne parcourt qu'eux */
+	std::vector<size_t> m_rangOccupe;       /*!< position de chaque seau non vide dans m_occupes */
+	std::vector<unsigned int> m_suivant;    /*!< chaînage de chaque sommet dans son seau */
+	std::vector<unsigned int> m_precedent;
+	std::vector<N> m_cle;
+	std::vector<bool> m_enAttente;
+	N m_courant;                            /*!< clé du seau en cours de vidage */
+	size_t m_taille;
+
+	static const unsigned int AUCUN = std::numeric_limits<unsigned int>::max();
+};
+
+
+#include "FilePriorite.hpp"
+
+#endif
@@ -0,0 +1,529 @@
+//
+//  FilePriorite.hpp
+//  politiques de file de priorité pour les algorithmes de plus court chemin
+//
+
+#include "FilePriorite.h"
+
+//----------------------------------------------------------------------------
+// FileEnsemble
+//----------------------------------------------------------------------------
+
+template<typename N>
+FileEnsemble<N>::FileEnsemble()
+{
+}
+
+//! \brief		Prépare une file vide pour des sommets 0..p_nbSommets-1
+//! \param[in]	p_nbSommets le nombre de sommets du graphe
+//! \param[in]	p_poidsMax le poids maximal d'un arc (non utilisé)
+template<typename N>
+void FileEnsemble<N>::initialiser(size_t p_nbSommets, const N &)
+{
+	m_ensemble.clear();
+	m_cle.resize(p_nbSommets);
+}
+
+template<typename N>
+bool FileEnsemble<N>::estVide() const
+{
+	return m_ensemble.empty();
+}
+
+template<typename N>
+size_t FileEnsemble<N>::reqTaille() const
+{
+	return m_ensemble.size();
+}
+
+//! \brief		Insère p_sommet avec la clé p_cle ou remplace sa clé si elle est plus petite
+template<typename N>
+void FileEnsemble<N>::insererOuDiminuer(unsigned int p_sommet, const N & p_cle)
+{
+	PRECONDITION(p_sommet < m_cle.size());
+	typename std::set< std::pair<N, unsigned int> >::iterator itr =
+			m_ensemble.find(std::make_pair(m_cle[p_sommet], p_sommet));
+	if (itr != m_ensemble.end())
+	{
+		if (!(p_cle < m_cle[p_sommet]))
+			return;
+		m_ensemble.erase(itr);
+	}
+	m_cle[p_sommet] = p_cle;
+	m_ensemble.insert(std::make_pair(p_cle, p_sommet));
+}
+
+//! \brief		Retire le sommet de clé minimale
+//! \param[out]	p_cle la clé du sommet retiré
+//! \return		le sommet retiré
+//! \pre		la file ne doit pas être vide
+template<typename N>
+unsigned int FileEnsemble<N>::extraireMin(N & p_cle)
+{
+	PRECONDITION(!estVide());
+	p_cle = m_ensemble.begin()->first;
+	unsigned int sommet = m_ensemble.begin()->second;
+	m_ensemble.erase(m_ensemble.begin());
+	return sommet;
+}
+
+template<typename N>
+void FileEnsemble<N>::vider()
+{
+	m_ensemble.clear();
+}
+
+template<typename N>
+const char * FileEnsemble<N>::nom()
+{
+	return "std::set";
+}
+
+//----------------------------------------------------------------------------
+// TasDAire
+//----------------------------------------------------------------------------
+
+template<typename N, unsigned int D>
+const unsigned int TasDAire<N,D>::ABSENT;
+
+template<typename N, unsigned int D>
+TasDAire<N,D>::TasDAire()
+{
+}
+
+//! \brief		Prépare un tas vide pour des sommets 0..p_nbSommets-1
+//! \param[in]	p_nbSommets le nombre de sommets du graphe
+//! \param[in]	p_poidsMax le poids maximal d'un arc (non utilisé)
+template<typename N, unsigned int D>
+void TasDAire<N,D>::initialiser(size_t p_nbSommets, const N &)
+{
+	m_tas.clear();
+	m_tas.reserve(p_nbSommets);
+	m_position.assign(p_nbSommets, ABSENT);
+}
+
+template<typename N, unsigned int D>
+bool TasDAire<N,D>::estVide() const
+{
+	return m_tas.empty();
+}
+
+template<typename N, unsigned int D>
+size_t TasDAire<N,D>::reqTaille() const
+{
+	return m_tas.size();
+}
+
+//! \brief		Ordre du tas: la clé, puis le numéro de sommet
+template<typename N, unsigned int D>
+bool TasDAire<N,D>::precede(const element & a, const element & b)
+{
+	return a.cle < b.cle || (!(b.cle < a.cle) && a.sommet < b.sommet);
+}
+
+//! \brief		Remonte l'élément à l'index p_index jusqu'à sa place
+template<typename N, unsigned int D>
+void TasDAire<N,D>::monter(unsigned int p_index)
+{
+	element courant = m_tas[p_index];
+	while (p_index > 0)
+	{
+		unsigned int parent = (p_index - 1) / D;
+		if (!precede(courant, m_tas[parent]))
+			break;
+		m_tas[p_index] = m_tas[parent];
+		m_position[m_tas[p_index].sommet] = p_index;
+		p_index = parent;
+	}
+	m_tas[p_index] = courant;
+	m_position[courant.sommet] = p_index;
+}
+
+//! \brief		Descend l'élément à l'index p_index jusqu'à sa place
+template<typename N, unsigned int D>
+void TasDAire<N,D>::descendre(unsigned int p_index)
+{
+	element courant = m_tas[p_index];
+	const unsigned int taille = m_tas.size();
+	for (;;)
+	{
+		unsigned int premier = p_index * D + 1;
+		if (premier >= taille)
+			break;
+		unsigned int dernier = premier + D < taille ? premier + D : taille;
+		unsigned int meilleur = premier;
+		for (unsigned int enfant = premier + 1; enfant < dernier; ++enfant)
+		{
+			if (precede(m_tas[enfant], m_tas[meilleur]))
+				meilleur = enfant;
+		}
+		if (!precede(m_tas[meilleur], courant))
+			break;
+		m_tas[p_index] = m_tas[meilleur];
+		m_position[m_tas[p_index].sommet] = p_index;
+		p_index = meilleur;
+	}
+	m_tas[p_index] = courant;
+	m_position[courant.sommet] = p_index;
+}
+
+//! \brief		Insère p_sommet avec la clé p_cle ou diminue sa clé en place si elle est plus petite
+template<typename N, unsigned int D>
+void TasDAire<N,D>::insererOuDiminuer(unsigned int p_sommet, const N & p_cle)
+{
+	PRECONDITION(p_sommet < m_position.size());
+	unsigned int index = m_position[p_sommet];
+	if (index == ABSENT)
+	{
+		element nouveau;
+		nouveau.cle = p_cle;
+		nouveau.sommet = p_sommet;
+		m_tas.push_back(nouveau);
+		monter(m_tas.size() - 1);
+	}
+	else if (p_cle < m_tas[index].cle)
+	{
+		m_tas[index].cle = p_cle;
+		monter(index);
+	}
+}
+
+//! \brief		Retire le sommet de clé minimale
+//! \param[out]	p_cle la clé du sommet retiré
+//! \return		le sommet retiré
+//! \pre		le tas ne doit pas être vide
+template<typename N, unsigned int D>
+unsigned int TasDAire<N,D>::extraireMin(N & p_cle)
+{
+	PRECONDITION(!estVide());
+	p_cle = m_tas.front().cle;
+	unsigned int sommet = m_tas.front().sommet;
+	m_position[sommet] = ABSENT;
+
+	m_tas.front() = m_tas.back();
+	m_tas.pop_back();
+	if (!m_tas.empty())
+		descendre(0);
+	return sommet;
+}
+
+//! \brief		Vide le tas en temps proportionnel au nombre d'éléments restants
+template<typename N, unsigned int D>
+void TasDAire<N,D>::vider()
+{
+	for (typename std::vector<element>::const_iterator itr = m_tas.begin(); itr != m_tas.end(); ++itr)
+		m_position[itr->sommet] = ABSENT;
+	m_tas.clear();
+}
+
+template<typename N, unsigned int D>
+const char * TasDAire<N,D>::nom()
+{
+	return D == 2 ? "tas binaire" : D == 4 ? "tas 4-aire" : "tas d-aire";
+}
+
+//----------------------------------------------------------------------------
+// TasRadix
+//----------------------------------------------------------------------------
+
+template<typename N>
+TasRadix<N>::TasRadix() : m_dernier(0), m_taille(0)
+{
+	static_assert(std::numeric_limits<N>::is_integer && !std::numeric_limits<N>::is_signed,
+			"TasRadix exige des clés entières non signées");
+}
+
+//! \brief		Prépare un tas vide pour des sommets 0..p_nbSommets-1
+//! \param[in]	p_nbSommets le nombre de sommets du graphe
+//! \param[in]	p_poidsMax le poids maximal d'un arc (non utilisé)
+template<typename N>
+void TasRadix<N>::initialiser(size_t p_nbSommets, const N &)
+{
+	for (unsigned int i = 0; i < NB_SEAUX; ++i)
+		m_seaux[i].clear();
+	m_dernier = 0;
+	m_taille = 0;
+	m_cle.resize(p_nbSommets);
+	m_enAttente.assign(p_nbSommets, false);
+}
+
+template<typename N>
+bool TasRadix<N>::estVide() const
+{
+	return m_taille == 0;
+}
+
+template<typename N>
+size_t TasRadix<N>::reqTaille() const
+{
+	return m_taille;
+}
+
+//! \brief		Numéro du seau d'une clé: 0 si elle est égale à la dernière clé extraite,
+//! \brief		sinon 1 + la position du bit le plus significatif qui les distingue
+template<typename N>
+unsigned int TasRadix<N>::indiceSeau(const N & p_cle, const N & p_dernier)
+{
+	N difference = p_cle ^ p_dernier;
+	unsigned int indice = 0;
+	while (difference != 0)
+	{
+		difference >>= 1;
+		++indice;
+	}
+	return indice;
+}
+
+//! \brief		Vrai si l'élément n'a pas été remplacé par une diminution de clé ni déjà extrait
+template<typename N>
+bool TasRadix<N>::estAJour(const std::pair<N, unsigned int> & p_element) const
+{
+	return m_enAttente[p_element.second] && m_cle[p_element.second] == p_element.first;
+}
+
+//! \brief		Insère p_sommet avec la clé p_cle ou diminue sa clé si elle est plus petite
+//! \pre		p_cle ne doit pas être inférieure à la dernière clé extraite
+template<typename N>
+void TasRadix<N>::insererOuDiminuer(unsigned int p_sommet, const N & p_cle)
+{
+	PRECONDITION(p_sommet < m_cle.size());
+	PRECONDITION(!(p_cle < m_dernier));
+	if (m_enAttente[p_sommet])
+	{
+		if (!(p_cle < m_cle[p_sommet]))
+			return;
+	}
+	else
+	{
+		m_enAttente[p_sommet] = true;
+		++m_taille;
+	}
+	m_cle[p_sommet] = p_cle;
+	m_seaux[indiceSeau(p_cle, m_dernier)].push_back(std::make_pair(p_cle, p_sommet));
+}
+
+//! \brief		Retire le sommet de clé minimale
+//! \brief		si le seau 0 est vide, le premier seau non vide est redistribué autour de sa clé minimale
+//! \param[out]	p_cle la clé du sommet retiré
+//! \return		le sommet retiré
+//! \pre		le tas ne doit pas être vide
+template<typename N>
+unsigned int TasRadix<N>::extraireMin(N & p_cle)
+{
+	PRECONDITION(!estVide());
+	for (;;)
+	{
+		while (!m_seaux[0].empty())
+		{
+			std::pair<N, unsigned int> element = m_seaux[0].back();
+			m_seaux[0].pop_back();
+			if (estAJour(element))
+			{
+				m_enAttente[element.second] = false;
+				--m_taille;
+				p_cle = element.first;
+				return element.second;
+			}
+		}
+
+		unsigned int indice = 1;
+		while (m_seaux[indice].empty())
+			++indice;
+
+		std::vector< std::pair<N, unsigned int> > & seau = m_seaux[indice];
+		bool trouve = false;
+		N minimum = 0;
+		for (typename std::vector< std::pair<N, unsigned int> >::const_iterator itr = seau.begin(); itr != seau.end(); ++itr)
+		{
+			if (estAJour(*itr) && (!trouve || itr->first < minimum))
+			{
+				minimum = itr->first;
+				trouve = true;
+			}
+		}
+		if (trouve)
+		{
+			m_dernier = minimum;
+			for (typename std::vector< std::pair<N, unsigned int> >::const_iterator itr = seau.begin(); itr != seau.end(); ++itr)
+			{
+				if (estAJour(*itr))
+					m_seaux[indiceSeau(itr->first, m_dernier)].push_back(*itr);
+			}
+		}
+		seau.clear();
+	}
+}
+
+//! \brief		Vide le tas en temps proportionnel au nombre d'éléments restants
+template<typename N>
+void TasRadix<N>::vider()
+{
+	for (unsigned int i = 0; i < NB_SEAUX; ++i)
+	{
+		for (typename std::vector< std::pair<N, unsigned int> >::const_iterator itr = m_seaux[i].begin(); itr != m_seaux[i].end(); ++itr)
+			m_enAttente[itr->second] = false;
+		m_seaux[i].clear();
+	}
+	m_dernier = 0;
+	m_taille = 0;
+}
+
+template<typename N>
+const char * TasRadix<N>::nom()
+{
+	return "tas radix";
+}
+
+//----------------------------------------------------------------------------
+// FileDial
+//----------------------------------------------------------------------------
+
+template<typename N>
+const unsigned int FileDial<N>::AUCUN;
+
+template<typename N>
+FileDial<N>::FileDial() : m_courant(0), m_taille(0)
+{
+	static_assert(std::numeric_limits<N>::is_integer, "FileDial exige des poids entiers");
+}
+
+//! \brief		Prépare une file vide pour des sommets 0..p_nbSommets-1
+//! \param[in]	p_nbSommets le nombre de sommets du graphe
+//! \param[in]	p_poidsMax le poids maximal d'un arc: détermine le nombre de seaux
+template<typename N>
+void FileDial<N>::initialiser(size_t p_nbSommets, const N & p_poidsMax)
+{
+	PRECONDITION(!(p_poidsMax < 0));
+	m_tetes.assign(static_cast<size_t>(p_poidsMax) + 1, AUCUN);
+	m_rangOccupe.resize(m_tetes.size());
+	m_occupes.clear();
+	m_suivant.resize(p_nbSommets);
+	m_precedent.resize(p_nbSommets);
+	m_cle.resize(p_nbSommets);
+	m_enAttente.assign(p_nbSommets, false);
+	m_courant = 0;
+	m_taille = 0;
+}
+
+template<typename N>
+bool FileDial<N>::estVide() const
+{
+	return m_taille == 0;
+}
+
+template<typename N>
+size_t FileDial<N>::reqTaille() const
+{
+	return m_taille;
+}
+
+//! \brief		Détache p_sommet de la liste de son seau
+template<typename N>
+void FileDial<N>::retirer(unsigned int p_sommet)
+{
+	unsigned int suivant = m_suivant[p_sommet];
+	unsigned int precedent = m_precedent[p_sommet];
+	if (precedent == AUCUN)
+	{
+		const size_t seau = m_cle[p_sommet] % m_tetes.size();
+		m_tetes[seau] = suivant;
+		if (suivant == AUCUN)
+			liberer(seau);
+	}
+	else
+		m_suivant[precedent] = suivant;
+	if (suivant != AUCUN)
+		m_precedent[suivant] = precedent;
+}
+
+//! \brief		Insère p_sommet avec la clé p_cle ou le déplace vers le seau de sa nouvelle clé si elle est plus petite
+//! \pre		p_cle doit être comprise entre la clé courante et la clé courante + poidsMax
+//! \note		une file vide avance sa clé courante jusqu'à p_cle si p_cle dépasse les seaux: une recherche
+//! \note		peut ainsi partir d'une clé non nulle (un instant de départ)
+template<typename N>
+void FileDial<N>::insererOuDiminuer(unsigned int p_sommet, const N & p_cle)
+{
+	PRECONDITION(p_sommet < m_cle.size());
+	if (m_taille == 0 && m_courant < p_cle && !(p_cle - m_courant < m_tetes.size()))
+		m_courant = p_cle;
+	PRECONDITION(!(p_cle < m_courant) && p_cle - m_courant < m_tetes.size());
+	if (m_enAttente[p_sommet])
+	{
+		if (!(p_cle < m_cle[p_sommet]))
+			return;
+		retirer(p_sommet);
+	}
+	else
+	{
+		m_enAttente[p_sommet] = true;
+		++m_taille;
+	}
+	m_cle[p_sommet] = p_cle;
+	const size_t seau = p_cle % m_tetes.size();
+	unsigned int & tete = m_tetes[seau];
+	m_precedent[p_sommet] = AUCUN;
+	m_suivant[p_sommet] = tete;
+	if (tete != AUCUN)
+		m_precedent[tete] = p_sommet;
+	else
+		occuper(seau);
+	tete = p_sommet;
+}
+
+//! \brief		Inscrit un seau qui vient de recevoir son premier sommet parmi les seaux non vides
+template<typename N>
+void FileDial<N>::occuper(size_t p_seau)
+{
+	m_rangOccupe[p_seau] = m_occupes.size();
+	m_occupes.push_back(p_seau);
+}
+
+//! \brief		Retire un seau qui vient de se vider des seaux non vides (le dernier prend sa place)
+template<typename N>
+void FileDial<N>::liberer(size_t p_seau)
+{
+	const size_t dernier = m_occupes.back();
+	m_occupes[m_rangOccupe[p_seau]] = dernier;
+	m_rangOccupe[dernier] = m_rangOccupe[p_seau];
+	m_occupes.pop_back();
+}
+
+//! \brief		Retire un sommet du premier seau non vide à partir de la clé courante
+//! \param[out]	p_cle la clé du sommet retiré
+//! \return		le sommet retiré
+//! \pre		la file ne doit pas être vide
+template<typename N>
+unsigned int FileDial<N>::extraireMin(N & p_cle)
+{
+	PRECONDITION(!estVide());
+	while (m_tetes[m_courant % m_tetes.size()] == AUCUN)
+		++m_courant;
+
+	unsigned int sommet = m_tetes[m_courant % m_tetes.size()];
+	retirer(sommet);
+	m_enAttente[sommet] = false;
+	--m_taille;
+	p_cle = m_cle[sommet];
+	return sommet;
+}
+
+//! \brief		Vide la file; seuls les seaux non vides sont parcourus, au plus un par sommet en attente
+template<typename N>
+void FileDial<N>::vider()
+{
+	for (size_t i = 0; i < m_occupes.size(); ++i)
+	{
+		for (unsigned int sommet = m_tetes[m_occupes[i]]; sommet != AUCUN; sommet = m_suivant[sommet])
+			m_enAttente[sommet] = false;
+		m_tetes[m_occupes[i]] = AUCUN;
+	}
+	m_occupes.clear();
+	m_taille = 0;
+	m_courant = 0;
+}
+
+template<typename N>
+const char * FileDial<N>::nom()
+{
+	return "file de Dial";
+}
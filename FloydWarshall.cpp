@@ -0,0 +1,145 @@
+/**
+ * \file   FloydWarshall.cpp
+ * \brief  Fichier contenant le noyau min-plus de Floyd-Warshall pour des poids de 32 bits (AVX2 ou scalaire)
+ */
+
+#include "FloydWarshall.h"
+
+#include <atomic>
+#include <stdint.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FLOYDWARSHALL_X86
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+const unsigned int INFINI = numeric_limits<unsigned int>::max();
+
+/**
+ * \brief Noyau scalaire: la boucle interne est sans branchement pour que le compilateur puisse la vectoriser
+ */
+void relaxerScalaire(unsigned int * p_distances, unsigned int * p_predecesseurs, size_t p_nbSommets,
+		size_t p_i0, size_t p_i1, size_t p_j0, size_t p_j1, size_t p_k0, size_t p_k1) {
+	for (size_t k = p_k0; k < p_k1; ++k) {
+		const unsigned int * rangeeK = p_distances + k * p_nbSommets;
+		const unsigned int * predK = p_predecesseurs != 0 ? p_predecesseurs + k * p_nbSommets : 0;
+		for (size_t i = p_i0; i < p_i1; ++i) {
+			unsigned int * rangeeI = p_distances + i * p_nbSommets;
+			const unsigned int dik = rangeeI[k];
+			if (dik == INFINI)
+				continue;
+			const unsigned int limite = INFINI - dik;
+			if (predK == 0) {
+				for (size_t j = p_j0; j < p_j1; ++j) {
+					unsigned int candidat = dik + min(rangeeK[j], limite);
+					rangeeI[j] = min(rangeeI[j], candidat);
+				}
+			}
+			else {
+				unsigned int * predI = p_predecesseurs + i * p_nbSommets;
+				for (size_t j = p_j0; j < p_j1; ++j) {
+					unsigned int candidat = dik + min(rangeeK[j], limite);
+					bool meilleur = candidat < rangeeI[j];
+					rangeeI[j] = meilleur ? candidat : rangeeI[j];
+					predI[j] = meilleur ? predK[j] : predI[j];
+				}
+			}
+		}
+	}
+}
+
+#ifdef FLOYDWARSHALL_X86
+/**
+ * \brief Noyau AVX2: 8 colonnes à la fois
+ *
+ * d(i, k) + min(d(k, j), max() - d(i, k)) ne déborde jamais et vaut max() si d(k, j) = max().
+ * Il n'y a pas de comparaison non signée en AVX2: la nouvelle distance est le minimum non signé,
+ * et le prédécesseur change là où ce minimum diffère de l'ancienne distance.
+ */
+__attribute__((target("avx2")))
+void relaxerAVX2(unsigned int * p_distances, unsigned int * p_predecesseurs, size_t p_nbSommets,
+		size_t p_i0, size_t p_i1, size_t p_j0, size_t p_j1, size_t p_k0, size_t p_k1) {
+	for (size_t k = p_k0; k < p_k1; ++k) {
+		const unsigned int * rangeeK = p_distances + k * p_nbSommets;
+		const unsigned int * predK = p_predecesseurs != 0 ? p_predecesseurs + k * p_nbSommets : 0;
+		for (size_t i = p_i0; i < p_i1; ++i) {
+			unsigned int * rangeeI = p_distances + i * p_nbSommets;
+			const unsigned int dik = rangeeI[k];
+			if (dik == INFINI)
+				continue;
+			const unsigned int limite = INFINI - dik;
+			const __m256i vDik = _mm256_set1_epi32((int) dik);
+			const __m256i vLimite = _mm256_set1_epi32((int) limite);
+			unsigned int * predI = p_predecesseurs != 0 ? p_predecesseurs + i * p_nbSommets : 0;
+			size_t j = p_j0;
+			for (; j + 8 <= p_j1; j += 8) {
+				__m256i dkj = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rangeeK + j));
+				__m256i dij = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rangeeI + j));
+				__m256i candidat = _mm256_add_epi32(vDik, _mm256_min_epu32(dkj, vLimite));
+				__m256i nouvelle = _mm256_min_epu32(candidat, dij);
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(rangeeI + j), nouvelle);
+				if (predI != 0) {
+					__m256i inchange = _mm256_cmpeq_epi32(nouvelle, dij);
+					__m256i pkj = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(predK + j));
+					__m256i pij = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(predI + j));
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(predI + j), _mm256_blendv_epi8(pkj, pij, inchange));
+				}
+			}
+			for (; j < p_j1; ++j) {
+				unsigned int candidat = dik + min(rangeeK[j], limite);
+				if (candidat < rangeeI[j]) {
+					rangeeI[j] = candidat;
+					if (predI != 0)
+						predI[j] = predK[j];
+				}
+			}
+		}
+	}
+}
+
+bool processeurAVX2() {
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+}
+#else
+bool processeurAVX2() {
+	return false;
+}
+#endif
+
+atomic<bool> g_avx2(processeurAVX2());
+
+}
+
+/**
+ * \brief Relaxe une tuile de poids de 32 bits, avec le noyau AVX2 s'il est actif, sinon le noyau scalaire
+ */
+void relaxerTuile(unsigned int * p_distances, unsigned int * p_predecesseurs, size_t p_nbSommets,
+		size_t p_i0, size_t p_i1, size_t p_j0, size_t p_j1, size_t p_k0, size_t p_k1) {
+#ifdef FLOYDWARSHALL_X86
+	if (g_avx2.load(memory_order_relaxed)) {
+		relaxerAVX2(p_distances, p_predecesseurs, p_nbSommets, p_i0, p_i1, p_j0, p_j1, p_k0, p_k1);
+		return;
+	}
+#endif
+	relaxerScalaire(p_distances, p_predecesseurs, p_nbSommets, p_i0, p_i1, p_j0, p_j1, p_k0, p_k1);
+}
+
+/**
+ * \brief Indique si le noyau AVX2 est utilisé
+ */
+bool reqMinPlusAVX2() {
+	return g_avx2.load();
+}
+
+/**
+ * \brief Active ou désactive le noyau AVX2 (par exemple pour comparer les deux noyaux)
+ * \note le noyau AVX2 ne peut être activé que si le processeur le permet
+ */
+void fixerMinPlusAVX2(bool p_actif) {
+	g_avx2.store(p_actif && processeurAVX2());
+}
@@ -0,0 +1,43 @@
+//
+//  FloydWarshall.h
+//  algorithme de Floyd-Warshall par tuiles sur une matrice de distances dense
+//
+
+#ifndef FLOYDWARSHALL_H
+#define FLOYDWARSHALL_H
+
+#include <cstddef>
+#include <limits>
+
+#include "ContratException.h"
+#include "BassinFils.h"
+
+//! \brief Floyd-Warshall par tuiles (blocked Floyd-Warshall) sur une matrice n x n rangée par rangée
+//! \brief Pour chaque bloc de pivots kb: la tuile diagonale (kb, kb) est d'abord fermée, puis les tuiles de
+//! \brief la rangée kb et de la colonne kb (qui ne lisent qu'elles-mêmes et la diagonale), puis toutes les
+//! \brief autres tuiles (qui ne lisent que la rangée et la colonne kb); les tuiles d'une même phase sont
+//! \brief indépendantes et réparties sur le bassin. Une tuile de TAILLE_TUILE x TAILLE_TUILE tient en cache L1.
+//! \brief numeric_limits<N>::max() signifie « aucun chemin »: l'addition sature et ne déborde jamais.
+//! \brief Pour N = unsigned int, le noyau min-plus utilise AVX2 si le processeur le permet (choisi à l'exécution),
+//! \brief sinon une boucle scalaire.
+//! \brief N est le type pour les poids
+
+const size_t TAILLE_TUILE = 64;
+
+template <typename N>
+void floydWarshallTuiles(N * p_distances, unsigned int * p_predecesseurs, size_t p_nbSommets, BassinFils & p_bassin);
+
+template <typename N>
+void relaxerTuile(N * p_distances, unsigned int * p_predecesseurs, size_t p_nbSommets,
+		size_t p_i0, size_t p_i1, size_t p_j0, size_t p_j1, size_t p_k0, size_t p_k1);
+
+void relaxerTuile(unsigned int * p_distances, unsigned int * p_predecesseurs, size_t p_nbSommets,
+		size_t p_i0, size_t p_i1, size_t p_j0, size_t p_j1, size_t p_k0, size_t p_k1);
+
+bool reqMinPlusAVX2();
+void fixerMinPlusAVX2(bool p_actif);
+
+
+#include "FloydWarshall.hpp"
+
+#endif
@@ -0,0 +1,84 @@
+//
+//  FloydWarshall.hpp
+//  algorithme de Floyd-Warshall par tuiles sur une matrice de distances dense
+//
+
+#include <algorithm>
+
+#include "FloydWarshall.h"
+
+//! \brief		Ferme la matrice de distances: p_distances[i * n + j] devient la plus courte distance de i à j
+//! \param[in,out]	p_distances la matrice n x n des poids des arcs (0 sur la diagonale, max() sans arc)
+//! \param[in,out]	p_predecesseurs nul, ou la matrice n x n des prédécesseurs: i pour un arc i -> j, et
+//! \param[in,out]	numeric_limits<unsigned int>::max() sur la diagonale et sans arc; en sortie, le prédécesseur
+//! \param[in,out]	de j sur le plus court chemin de i à j
+//! \param[in]	p_bassin le bassin de fils d'exécution qui se partage les tuiles de chaque phase
+//! \pre		la diagonale est nulle et les poids ne sont pas négatifs
+template<typename N>
+void floydWarshallTuiles(N * p_distances, unsigned int * p_predecesseurs, size_t p_nbSommets, BassinFils & p_bassin)
+{
+	const size_t n = p_nbSommets;
+	const size_t nbBlocs = (n + TAILLE_TUILE - 1) / TAILLE_TUILE;
+	for (size_t kb = 0; kb < nbBlocs; ++kb)
+	{
+		const size_t k0 = kb * TAILLE_TUILE, k1 = std::min(n, k0 + TAILLE_TUILE);
+		relaxerTuile(p_distances, p_predecesseurs, n, k0, k1, k0, k1, k0, k1);
+
+		//tâche b < nbBlocs: tuile (kb, b) de la rangée; sinon tuile (b - nbBlocs, kb) de la colonne
+		p_bassin.executer(2 * nbBlocs, [&](unsigned int b, unsigned int)
+		{
+			const size_t bloc = b < nbBlocs ? b : b - nbBlocs;
+			if (bloc == kb)
+				return;
+			const size_t b0 = bloc * TAILLE_TUILE, b1 = std::min(n, b0 + TAILLE_TUILE);
+			if (b < nbBlocs)
+				relaxerTuile(p_distances, p_predecesseurs, n, k0, k1, b0, b1, k0, k1);
+			else
+				relaxerTuile(p_distances, p_predecesseurs, n, b0, b1, k0, k1, k0, k1);
+		});
+
+		//une tâche par rangée de tuiles
+		p_bassin.executer(nbBlocs, [&](unsigned int ib, unsigned int)
+		{
+			if (ib == kb)
+				return;
+			const size_t i0 = ib * TAILLE_TUILE, i1 = std::min(n, i0 + TAILLE_TUILE);
+			for (size_t jb = 0; jb < nbBlocs; ++jb)
+				if (jb != kb)
+					relaxerTuile(p_distances, p_predecesseurs, n, i0, i1, jb * TAILLE_TUILE,
+							std::min(n, (jb + 1) * TAILLE_TUILE), k0, k1);
+		});
+	}
+}
+
+//! \brief		Relaxe la tuile [p_i0, p_i1[ x [p_j0, p_j1[ par les pivots [p_k0, p_k1[ (version générique, scalaire)
+//! \brief		d(i, j) = min(d(i, j), d(i, k) + d(k, j)), en saturant à max(); le prédécesseur ne change
+//! \brief		que si la distance diminue strictement
+template<typename N>
+void relaxerTuile(N * p_distances, unsigned int * p_predecesseurs, size_t p_nbSommets,
+		size_t p_i0, size_t p_i1, size_t p_j0, size_t p_j1, size_t p_k0, size_t p_k1)
+{
+	const N infini = std::numeric_limits<N>::max();
+	for (size_t k = p_k0; k < p_k1; ++k)
+	{
+		const N * rangeeK = p_distances + k * p_nbSommets;
+		for (size_t i = p_i0; i < p_i1; ++i)
+		{
+			N * rangeeI = p_distances + i * p_nbSommets;
+			const N dik = rangeeI[k];
+			if (dik == infini)
+				continue;
+			const N limite = infini - dik;
+			for (size_t j = p_j0; j < p_j1; ++j)
+			{
+				N candidat = dik + std::min(rangeeK[j], limite);
+				if (candidat < rangeeI[j])
+				{
+					rangeeI[j] = candidat;
+					if (p_predecesseurs != 0)
+						p_predecesseurs[i * p_nbSommets + j] = p_predecesseurs[k * p_nbSommets + j];
+				}
+			}
+		}
+	}
+}
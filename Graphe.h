@@ -14,60 +14,332 @@
 #include <limits>
 
 #include <utility>
+#include <type_traits>
 #include <set>
 #include <algorithm>
 
 #include <iostream>
 #include "ContratException.h"
+#include "GrapheCSR.h"
+#include "FilePriorite.h"
+#include "ContexteRecherche.h"
+#include "TableDistances.h"
+#include "BassinFils.h"
+#include "TableReperes.h"
+#include "HierarchieContraction.h"
+#include "ReserveNoms.h"
+#include "Chemin.h"
+#include "ProfilsTemps.h"
+#include "ContextePareto.h"
+#include "CacheArbres.h"
+#include "FloydWarshall.h"
+#include "ContexteDense.h"
+#include "AllocateurAligne.h"
+#include "Instrumentation.h"
 
 
 
-//! \brief Patron de classe pour graphes orientés pondérés utilisant une matrice de valuation
+//! \brief Patron de classe pour graphes orientés pondérés
 //! \brief les numéros de sommets débutent à 0
+//! \brief les arcs ajoutés sont mis en attente jusqu'à l'appel de figer(), qui les range en format CSR
+//! \brief (arcs sortants et arcs entrants); un arc i -> j ajouté de nouveau remplace le précédent
+//! \brief modifierPoids() et retirerArc() changent un arc figé dans toutes les représentations
+//! \brief reqVersion() change à chaque changement des arcs figés (figer(), modifierPoids(), retirerArc(), renumeroter());
+//! \brief les repères, hiérarchies et profils construits avant un changement sont refusés par les recherches
+//! \brief un arc entre deux sommets de même nom (deux quais d'une station) est une correspondance
+//! \brief la matrice de valuation (un seul bloc n x n aligné) n'est allouée qu'au premier appel de reqPoids(),
+//! \brief dijkstra(), dijkstraDense() ou floydWarshall()
+//! \brief renumeroter() range les sommets dans un autre ordre (par exemple ordreCuthillMcKee(), pour que les
+//! \brief voisins soient proches en mémoire); les numéros donnés et rendus par le graphe restent ceux d'origine
+//! \brief (numéros externes), sauf ceux de reqArcs(), reqArcsInverses(), des profils, repères et hiérarchies,
+//! \brief qui suivent l'ordre interne (voir reqInterne() et reqExterne())
+//! \brief les noms sont rangés une seule fois par nom distinct; les sommets de même nom
+//! \brief (par exemple les quais d'une même station) sont retrouvés par trouverSommets()
 //! \brief T est le type pour les noms de sommets
 //! \brief N est le type pour les poids
 template <typename T,typename N>
 class Graphe
 {
 public:
-	
-    struct voisin
-	{
-		unsigned int destination;
-		N poids;
-		voisin(unsigned int p_destination, N p_poids) : destination(p_destination), poids(p_poids){}
-	};
-	
-	
-	typedef std::vector< std::vector<voisin> > liste_voisins;
 
+	typedef typename GrapheCSR<N>::arc arc;
 
 	Graphe();
 	Graphe(size_t p_nombre);
+	Graphe(const std::vector<T> & p_noms, const GrapheCSR<N> & p_arcs, const GrapheCSR<N> & p_arcsInverses,
+			const std::vector<unsigned int> & p_externes = std::vector<unsigned int>());
 	~Graphe();
 
 	const N & reqPoids(unsigned int i, unsigned int j) const;
 	void ajouteArc(unsigned int i, unsigned int j, N poids);
 	size_t reqNbSommets() const;
-	T reqNom(unsigned int i) const;
+	const T & reqNom(unsigned int i) const;
 	void nommer(unsigned int i, const T & p_nom);
+	void trouverSommets(const T & p_nom, std::vector<unsigned int> & p_sommets) const;
+
+	void figer();
+	bool estFige() const;
+	N modifierPoids(unsigned int i, unsigned int j, N poids);
+	N retirerArc(unsigned int i, unsigned int j);
+	const GrapheCSR<N> & reqArcs() const;
+	const GrapheCSR<N> & reqArcsInverses() const;
+	unsigned long reqVersion() const;
+
+	void ordreLargeur(std::vector<unsigned int> & p_ordre) const;
+	void ordreCuthillMcKee(std::vector<unsigned int> & p_ordre) const;
+	void renumeroter(const std::vector<unsigned int> & p_ordre);
+	bool estRenumerote() const;
+	unsigned int reqInterne(unsigned int p_sommet) const;
+	unsigned int reqExterne(unsigned int p_sommet) const;
 
 	N dijkstra(const unsigned int & p_origine, const unsigned int & p_destination,
 			std::vector< std::pair<unsigned int, T> > & p_chemin) const;
 
+	N dijkstraDense(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin) const;
+	N dijkstraDense(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin, ContexteDense<N> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
+				std::vector< std::pair<unsigned int, T> > & p_chemin) const;
+
+	template <typename FilePriorite>
+	N dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
+				std::vector< std::pair<unsigned int, T> > & p_chemin,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin) const;
+
+	template <typename FilePriorite>
 	N dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraEnCache(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin, CacheArbres<N> & p_cache) const;
+
+	template <typename FilePriorite>
+	N dijkstraEnCache(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin, CacheArbres<N> & p_cache,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraBidirectionnel(const unsigned int & p_origine, const unsigned int & p_destination,
 				std::vector< std::pair<unsigned int, T> > & p_chemin) const;
+
+	template <typename FilePriorite>
+	N dijkstraBidirectionnel(const unsigned int & p_origine, const unsigned int & p_destination,
+				std::vector< std::pair<unsigned int, T> > & p_chemin,
+				ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+				ContexteRecherche<N, FilePriorite> & p_contexteArriere) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraBidirectionnel(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin) const;
+
+	template <typename FilePriorite>
+	N dijkstraBidirectionnel(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin,
+				ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+				ContexteRecherche<N, FilePriorite> & p_contexteArriere) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraGroupes(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+				Chemin<T, N> & p_chemin) const;
+
+	template <typename FilePriorite>
+	N dijkstraGroupes(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+				Chemin<T, N> & p_chemin,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraStations(const T & p_origine, const T & p_destination, Chemin<T, N> & p_chemin) const;
+
+	template <typename FilePriorite>
+	N dijkstraStations(const T & p_origine, const T & p_destination, Chemin<T, N> & p_chemin,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	bool estCorrespondance(unsigned int i, unsigned int j) const;
+	unsigned int compterCorrespondances(const Chemin<T, N> & p_chemin) const;
+
+	template <typename FilePriorite = TasDAire<unsigned long long> >
+	N dijkstraCorrespondances(const unsigned int & p_origine, const unsigned int & p_destination, N p_attente,
+				bool p_moinsDeCorrespondances, Chemin<T, N> & p_chemin) const;
+
+	template <typename FilePriorite>
+	N dijkstraCorrespondances(const unsigned int & p_origine, const unsigned int & p_destination, N p_attente,
+				bool p_moinsDeCorrespondances, Chemin<T, N> & p_chemin,
+				ContexteRecherche<unsigned long long, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	void kPlusCourtsChemins(const unsigned int & p_origine, const unsigned int & p_destination, unsigned int p_k,
+				std::vector< Chemin<T, N> > & p_chemins) const;
+
+	template <typename FilePriorite>
+	void kPlusCourtsChemins(const unsigned int & p_origine, const unsigned int & p_destination, unsigned int p_k,
+				std::vector< Chemin<T, N> > & p_chemins,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	void frontPareto(const unsigned int & p_origine, const unsigned int & p_destination, N p_attente,
+				std::vector< Chemin<T, N> > & p_front, unsigned int p_maxEtiquettes = 16) const;
+	void frontPareto(const unsigned int & p_origine, const unsigned int & p_destination, N p_attente,
+				std::vector< Chemin<T, N> > & p_front, unsigned int p_maxEtiquettes,
+				ContextePareto<N> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraHoraire(const unsigned int & p_origine, const unsigned int & p_destination, N p_depart,
+				const ProfilsTemps<N> & p_profils, Chemin<T, N> & p_chemin) const;
+
+	template <typename FilePriorite>
+	N dijkstraHoraire(const unsigned int & p_origine, const unsigned int & p_destination, N p_depart,
+				const ProfilsTemps<N> & p_profils, Chemin<T, N> & p_chemin,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	void calculerReperes(unsigned int p_nbReperes, TableReperes & p_table) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraALT(const unsigned int & p_origine, const unsigned int & p_destination,
+				std::vector< std::pair<unsigned int, T> > & p_chemin,
+				const TableReperes & p_reperes) const;
+
+	template <typename FilePriorite>
+	N dijkstraALT(const unsigned int & p_origine, const unsigned int & p_destination,
+				std::vector< std::pair<unsigned int, T> > & p_chemin,
+				const TableReperes & p_reperes,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraALT(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin,
+				const TableReperes & p_reperes) const;
+
+	template <typename FilePriorite>
+	N dijkstraALT(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin,
+				const TableReperes & p_reperes,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	void construireHierarchie(HierarchieContraction<N> & p_hierarchie) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraCH(const unsigned int & p_origine, const unsigned int & p_destination,
+				std::vector< std::pair<unsigned int, T> > & p_chemin,
+				const HierarchieContraction<N> & p_hierarchie) const;
+
+	template <typename FilePriorite>
+	N dijkstraCH(const unsigned int & p_origine, const unsigned int & p_destination,
+				std::vector< std::pair<unsigned int, T> > & p_chemin,
+				const HierarchieContraction<N> & p_hierarchie,
+				ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+				ContexteRecherche<N, FilePriorite> & p_contexteArriere) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	N dijkstraCH(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin,
+				const HierarchieContraction<N> & p_hierarchie) const;
+
+	template <typename FilePriorite>
+	N dijkstraCH(const unsigned int & p_origine, const unsigned int & p_destination,
+				Chemin<T, N> & p_chemin,
+				const HierarchieContraction<N> & p_hierarchie,
+				ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+				ContexteRecherche<N, FilePriorite> & p_contexteArriere) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	void unAPlusieurs(unsigned int p_origine, const std::vector<unsigned int> & p_destinations, N * p_distances) const;
+
+	template <typename FilePriorite>
+	void unAPlusieurs(unsigned int p_origine, const std::vector<unsigned int> & p_destinations, N * p_distances,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	void matriceDistances(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+				N * p_matrice) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	void matriceDistances(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+				N * p_matrice, BassinFils & p_bassin) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	void matriceDistances(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+				N * p_matrice, const HierarchieContraction<N> & p_hierarchie, BassinFils & p_bassin) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	void toutesLesPaires(TableDistances<N> & p_table, bool p_avecPredecesseurs = true) const;
+
+	template <typename FilePriorite = TasDAire<N> >
+	void toutesLesPaires(TableDistances<N> & p_table, bool p_avecPredecesseurs, BassinFils & p_bassin) const;
+
+	void floydWarshall(TableDistances<N> & p_table, bool p_avecPredecesseurs = true) const;
+	void floydWarshall(TableDistances<N> & p_table, bool p_avecPredecesseurs, BassinFils & p_bassin) const;
+
+	void deltaStepping(const unsigned int & p_origine, std::vector<N> & p_distances,
+				std::vector<unsigned int> & p_predecesseurs, N p_largeur = 0) const;
+	void deltaStepping(const unsigned int & p_origine, std::vector<N> & p_distances,
+				std::vector<unsigned int> & p_predecesseurs, N p_largeur, BassinFils & p_bassin) const;
     
 private:
+	template <typename FilePriorite>
 	void DijkstraCalculerChemins(const unsigned int p_origine,
 								std::vector<N>& p_distance_minimum,
 								std::vector<unsigned int>& p_predecesseur) const;
 
+	template <typename FilePriorite>
+	void DijkstraCalculerChemins(const unsigned int p_origine, const unsigned int p_destination,
+								ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite>
+	void DijkstraCalculerChemins(const unsigned int p_origine, const unsigned int p_destination,
+								const GrapheCSR<N> & p_arcs,
+								ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite>
+	void dijkstraMasque(const unsigned int p_origine, const unsigned int p_destination,
+				const std::vector<unsigned int> & p_marqueSommets, unsigned int p_marqueSommet,
+				const std::vector<unsigned int> & p_marqueArcs, unsigned int p_marqueArc,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+
+	template <typename FilePriorite>
+	void unAPlusieurs(unsigned int p_origine, const std::vector<unsigned int> & p_destinationsTriees,
+				const std::vector<unsigned int> & p_destinations, N * p_distances,
+				ContexteRecherche<N, FilePriorite> & p_contexte) const;
+	static void trierSansDoublons(const std::vector<unsigned int> & p_sommets, std::vector<unsigned int> & p_tries);
+
+	template <typename Cle, typename FilePriorite>
+	void construireChemin(const unsigned int p_destination,
+						const ContexteRecherche<Cle, FilePriorite> & p_contexte,
+						std::vector<unsigned int> & p_sommets) const;
+	void construireMatrice() const;
+	void arbreArcsSerres(unsigned int p_origine, const N * p_distances, unsigned int * p_predecesseurs,
+				std::vector<unsigned int> & p_file) const;
+	static bool diminuerAtomique(N & p_valeur, N p_nouvelle);
+	void parcoursLargeur(bool p_parDegre, std::vector<unsigned int> & p_ordre) const;
+	unsigned int interne(unsigned int p_sommet) const;
+	unsigned int externe(unsigned int p_sommet) const;
+	void versExterne(std::vector<unsigned int> & p_sommets) const;
+	const std::vector<unsigned int> & versInterne(const std::vector<unsigned int> & p_sommets,
+				std::vector<unsigned int> & p_internes) const;
+	void tableVersExterne(TableDistances<N> & p_table) const;
+	void lierNom(unsigned int i, unsigned int p_poignee);
+	void delierNom(unsigned int i);
+
 	size_t m_nbSommets;
-	std::vector<T> m_noms;  /*! les noms donnés aux sommets */
-    std::vector< std::vector<N> > m_matrice; /*!< la matrice d'adjacence */
-    
-    liste_voisins m_listeVoisin;
+	ReserveNoms<T> m_reserveNoms;  /*!< les noms distincts donnés aux sommets */
+	std::vector<unsigned int> m_noms;  /*!< la poignée du nom de chaque sommet */
+	std::vector<unsigned int> m_premierDuNom;  /*!< premier sommet portant chaque nom (par poignée), ou AUCUN */
+	std::vector<unsigned int> m_suivantMemeNom;  /*!< chaînage double des sommets de même nom */
+	std::vector<unsigned int> m_precedentMemeNom;
+	std::vector<arc> m_arcsEnAttente; /*!< les arcs ajoutés depuis le dernier appel à figer() */
+	GrapheCSR<N> m_arcs; /*!< les arcs figés, en format CSR */
+	GrapheCSR<N> m_arcsInverses; /*!< les mêmes arcs, rangés par destination (pour les recherches arrière) */
+	mutable std::vector<N, AllocateurAligne<N> > m_matrice; /*!< la matrice d'adjacence n x n (par rangée), allouée sur demande */
+	unsigned long m_version; /*!< incrémentée à chaque changement des arcs figés */
+	std::vector<unsigned int> m_versInterne; /*!< numéro interne de chaque numéro externe; vide si l'ordre est celui d'origine */
+	std::vector<unsigned int> m_versExterne; /*!< numéro externe de chaque numéro interne; vide si l'ordre est celui d'origine */
 };
 
 
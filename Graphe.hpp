@@ -12,34 +12,57 @@ using namespace std;
 //! \brief		Constructeur sans paramètre
 //! \post		Un graphe vide est créé
 template<typename T,typename N>
-Graphe<T,N>::Graphe() : m_nbSommets(0)
+Graphe<T,N>::Graphe() : m_nbSommets(0), m_version(0)
 {
 }
 
 //! \brief		Constructeur avec un paramètre n = nombre de sommets
 //! \brief		initialise le vecteur m_noms avec n éléments
-//! \brief		initialise la matrice de valuation: 0 dans la diagonale et infini ailleurs
+//! \brief		la matrice de valuation n'est pas allouée ici (voir construireMatrice())
 //! \post		Un graphe vide est créé de n sommets
 template<typename T,typename N>
-Graphe<T,N>::Graphe(size_t n) : m_nbSommets(n)
+Graphe<T,N>::Graphe(size_t n) : m_nbSommets(n), m_noms(n, ReserveNoms<T>::AUCUN),
+	m_suivantMemeNom(n), m_precedentMemeNom(n), m_arcs(n, std::vector<arc>()), m_arcsInverses(n, std::vector<arc>()),
+	m_version(0)
 {
-	m_nbSommets = n;
-	m_noms.resize(n);
-	m_matrice.resize(n);
-	m_listeVoisin.resize(n);
+	const unsigned int sansNom = m_reserveNoms.interner(T());
 	for (unsigned int i = 0; i < n; ++i)
+		lierNom(i, sansNom);
+}
+
+//! \brief		Constructeur sur des arcs déjà rangés (par exemple lus d'un fichier binaire)
+//! \brief		les tableaux CSR sont partagés, pas copiés
+//! \param[in]	p_noms les noms des sommets
+//! \param[in]	p_arcs les arcs, rangés par origine
+//! \param[in]	p_arcsInverses les mêmes arcs, rangés par destination
+//! \param[in]	p_externes vide, ou le numéro externe de chaque sommet (voir renumeroter())
+//! \pre		les trois paramètres décrivent le même nombre de sommets et d'arcs
+//! \post		Le graphe créé est figé
+template<typename T,typename N>
+Graphe<T,N>::Graphe(const std::vector<T> & p_noms, const GrapheCSR<N> & p_arcs, const GrapheCSR<N> & p_arcsInverses,
+		const std::vector<unsigned int> & p_externes)
+	: m_nbSommets(p_noms.size()), m_noms(p_noms.size(), ReserveNoms<T>::AUCUN),
+	  m_suivantMemeNom(p_noms.size()), m_precedentMemeNom(p_noms.size()), m_arcs(p_arcs), m_arcsInverses(p_arcsInverses),
+	  m_version(0)
+{
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+		lierNom(i, m_reserveNoms.interner(p_noms[i]));
+	PRECONDITION(p_arcs.reqNbSommets() == m_nbSommets && p_arcsInverses.reqNbSommets() == m_nbSommets);
+	PRECONDITION(p_arcs.reqNbArcs() == p_arcsInverses.reqNbArcs());
+	PRECONDITION(p_externes.empty() || p_externes.size() == m_nbSommets);
+	if (!p_externes.empty())
 	{
-		m_matrice[i].resize(n);
-		for (unsigned int j = 0; j < n; ++j)
+		m_versExterne = p_externes;
+		m_versInterne.assign(m_nbSommets, ReserveNoms<T>::AUCUN);
+		for (unsigned int i = 0; i < m_nbSommets; ++i)
 		{
-			if (i == j)
-				m_matrice[i][j] = 0;
-			else
-				m_matrice[i][j] = numeric_limits<N>::max();
+			PRECONDITION(p_externes[i] < m_nbSommets && m_versInterne[p_externes[i]] == ReserveNoms<T>::AUCUN);
+			m_versInterne[p_externes[i]] = i;
 		}
 	}
-
+	POSTCONDITION(estFige());
 }
+
 //! \brief		Destructeur
 //! \post		Le graphe est détruit
 template<typename T,typename N>
@@ -57,22 +80,26 @@ size_t Graphe<T,N>::reqNbSommets() const
 
 //! \brief		Obtient le nom d'un sommet
 //! \param[in] 	i L'index du sommet
-//! \return 	le nom du sommet
+//! \return 	le nom du sommet, rangé une seule fois pour tous les sommets de ce nom
 template<typename T,typename N>
-T Graphe<T,N>::reqNom(unsigned int i) const
+const T & Graphe<T,N>::reqNom(unsigned int i) const
 {
-	return m_noms[i];
+	return m_reserveNoms.reqNom(m_noms[interne(i)]);
 }
 
 //! \brief 		Obtient le poid entre deux sommet selon l'algorithme originale
+//! \brief		la matrice de valuation est construite au premier appel
 //! \param[in]	i Index sommet origine
 //! \param[in] 	j Index sommet destination
 //! \return		Le poids entre ces deux sommets
+//! \pre		le graphe doit être figé
 template<typename T,typename N>
 const N & Graphe<T,N>::reqPoids(unsigned int i, unsigned int j) const
 {
 	PRECONDITION( i< m_nbSommets && j < m_nbSommets);
-	return m_matrice[i][j];
+	PRECONDITION( estFige());
+	construireMatrice();
+	return m_matrice[interne(i) * m_nbSommets + interne(j)];
 }
 
 
@@ -82,18 +109,396 @@ const N & Graphe<T,N>::reqPoids(unsigned int i, unsigned int j) const
 template<typename T,typename N>
 void Graphe<T,N>::nommer(unsigned int i, const T & p_nom)
 {
-	m_noms[i] = p_nom; // operator= doit exister pour le type T
+	PRECONDITION( i < m_nbSommets);
+	const unsigned int sommet = interne(i);
+	delierNom(sommet);
+	lierNom(sommet, m_reserveNoms.interner(p_nom)); // std::hash<T> et operator== doivent exister pour le type T
+}
+
+//! \brief		Obtient tous les sommets qui portent un nom donné
+//! \param[in]	p_nom le nom cherché
+//! \param[out]	p_sommets les sommets de ce nom, en ordre croissant (vide si aucun sommet n'a ce nom)
+template<typename T,typename N>
+void Graphe<T,N>::trouverSommets(const T & p_nom, std::vector<unsigned int> & p_sommets) const
+{
+	p_sommets.clear();
+	unsigned int poignee = m_reserveNoms.trouver(p_nom);
+	if (poignee == ReserveNoms<T>::AUCUN)
+		return;
+	for (unsigned int sommet = m_premierDuNom[poignee]; sommet != ReserveNoms<T>::AUCUN; sommet = m_suivantMemeNom[sommet])
+		p_sommets.push_back(externe(sommet));
+	std::sort(p_sommets.begin(), p_sommets.end());
+}
+
+//! \brief		Donne au sommet i le nom de poignée p_poignee, en tête de la liste des sommets de ce nom
+//! \pre		le sommet i ne doit être dans aucune liste
+template<typename T,typename N>
+void Graphe<T,N>::lierNom(unsigned int i, unsigned int p_poignee)
+{
+	if (p_poignee >= m_premierDuNom.size())
+		m_premierDuNom.resize(p_poignee + 1, ReserveNoms<T>::AUCUN);
+	m_noms[i] = p_poignee;
+	m_precedentMemeNom[i] = ReserveNoms<T>::AUCUN;
+	m_suivantMemeNom[i] = m_premierDuNom[p_poignee];
+	if (m_premierDuNom[p_poignee] != ReserveNoms<T>::AUCUN)
+		m_precedentMemeNom[m_premierDuNom[p_poignee]] = i;
+	m_premierDuNom[p_poignee] = i;
+}
+
+//! \brief		Retire le sommet i de la liste des sommets de son nom
+template<typename T,typename N>
+void Graphe<T,N>::delierNom(unsigned int i)
+{
+	const unsigned int AUCUN = ReserveNoms<T>::AUCUN;
+	if (m_precedentMemeNom[i] != AUCUN)
+		m_suivantMemeNom[m_precedentMemeNom[i]] = m_suivantMemeNom[i];
+	else
+		m_premierDuNom[m_noms[i]] = m_suivantMemeNom[i];
+	if (m_suivantMemeNom[i] != AUCUN)
+		m_precedentMemeNom[m_suivantMemeNom[i]] = m_precedentMemeNom[i];
 }
 
 //! \brief ajoute un arc d'un poids donné par longueur
+//! \brief l'arc est mis en attente: il ne sera vu par les algorithmes qu'après l'appel de figer()
 template<typename T,typename N>
 void Graphe<T,N>::ajouteArc(unsigned int i, unsigned int j, N poids)
 {
 	PRECONDITION( i< m_nbSommets && j < m_nbSommets);
-	m_matrice[i][j] = poids;
-	m_listeVoisin[i].push_back(voisin(j, poids));
+	m_arcsEnAttente.push_back(arc(interne(i), interne(j), poids));
+}
+
+//! \brief		Range les arcs en attente avec les arcs déjà figés dans une nouvelle représentation CSR
+//! \brief		à appeler une fois le chargement terminé, avant toute recherche de chemin
+//! \brief		si un arc i -> j a été ajouté plusieurs fois, seul le dernier poids est gardé,
+//! \brief		à la place du premier (comme l'écrasement d'une case de la matrice de valuation)
+//! \post		estFige() est vrai, il n'y a pas deux arcs i -> j et la matrice de valuation est libérée
+template<typename T,typename N>
+void Graphe<T,N>::figer()
+{
+	if (m_arcsEnAttente.empty())
+		return;
+
+	std::vector<arc> tousLesArcs;
+	m_arcs.listerArcs(tousLesArcs);
+	tousLesArcs.insert(tousLesArcs.end(), m_arcsEnAttente.begin(), m_arcsEnAttente.end());
+
+	m_arcs = GrapheCSR<N>(m_nbSommets, tousLesArcs).fusionnerDoublons();
+	m_arcsInverses = m_arcs.transposer();
+
+	std::vector<arc>().swap(m_arcsEnAttente);
+	std::vector<N, AllocateurAligne<N> >().swap(m_matrice);
+	++m_version;
+	POSTCONDITION(estFige());
+}
+
+//! \brief		Change le poids de l'arc i -> j dans les arcs, les arcs inverses et la matrice de valuation
+//! \param[in]	poids le nouveau poids
+//! \return		l'ancien poids
+//! \pre		le graphe doit être figé et l'arc i -> j doit exister
+//! \note		aucune recherche ne doit être en cours sur ce graphe; les repères, hiérarchies et profils
+//! \note		construits avant doivent être reconstruits
+template<typename T,typename N>
+N Graphe<T,N>::modifierPoids(unsigned int i, unsigned int j, N poids)
+{
+	PRECONDITION( i < m_nbSommets && j < m_nbSommets);
+	PRECONDITION( estFige());
+	i = interne(i);
+	j = interne(j);
+	unsigned int k = m_arcs.trouverArc(i, j);
+	unsigned int kInverse = m_arcsInverses.trouverArc(j, i);
+	PRECONDITION( k != numeric_limits<unsigned int>::max() && kInverse != numeric_limits<unsigned int>::max());
+
+	N ancien = m_arcs.reqPoids(k);
+	m_arcs.modifierPoids(k, poids);
+	m_arcsInverses.modifierPoids(kInverse, poids);
+	++m_version;
+	if (!m_matrice.empty() && i != j)
+		m_matrice[i * m_nbSommets + j] = poids;
+	return ancien;
+}
+
+//! \brief		Retire l'arc i -> j des arcs, des arcs inverses et de la matrice de valuation
+//! \return		le poids de l'arc retiré
+//! \pre		le graphe doit être figé et l'arc i -> j doit exister
+//! \note		linéaire dans le nombre d'arcs; aucune recherche ne doit être en cours sur ce graphe;
+//! \note		les repères, hiérarchies et profils construits avant doivent être reconstruits
+template<typename T,typename N>
+N Graphe<T,N>::retirerArc(unsigned int i, unsigned int j)
+{
+	PRECONDITION( i < m_nbSommets && j < m_nbSommets);
+	PRECONDITION( estFige());
+	i = interne(i);
+	j = interne(j);
+	unsigned int k = m_arcs.trouverArc(i, j);
+	unsigned int kInverse = m_arcsInverses.trouverArc(j, i);
+	PRECONDITION( k != numeric_limits<unsigned int>::max() && kInverse != numeric_limits<unsigned int>::max());
+
+	N ancien = m_arcs.reqPoids(k);
+	m_arcs.retirerArc(k);
+	m_arcsInverses.retirerArc(kInverse);
+	++m_version;
+	if (!m_matrice.empty() && i != j)
+		m_matrice[i * m_nbSommets + j] = numeric_limits<N>::max();
+	return ancien;
+}
+
+//! \brief		Indique si tous les arcs ajoutés ont été rangés par figer()
+template<typename T,typename N>
+bool Graphe<T,N>::estFige() const
+{
+	return m_arcsEnAttente.empty();
+}
+
+//! \brief		Obtient les arcs figés en format CSR
+template<typename T,typename N>
+const GrapheCSR<N> & Graphe<T,N>::reqArcs() const
+{
+	return m_arcs;
+}
+
+//! \brief		Obtient le numéro de version des arcs figés, qui change à chaque changement d'un arc
+template<typename T,typename N>
+unsigned long Graphe<T,N>::reqVersion() const
+{
+	return m_version;
+}
+
+//! \brief		Obtient les arcs figés rangés par destination: les arcs "sortants" de j sont les arcs i -> j
+template<typename T,typename N>
+const GrapheCSR<N> & Graphe<T,N>::reqArcsInverses() const
+{
+	return m_arcsInverses;
+}
+
+//! \brief		Numéro interne (rang en mémoire) d'un numéro de sommet externe
+template<typename T,typename N>
+inline unsigned int Graphe<T,N>::interne(unsigned int p_sommet) const
+{
+	return p_sommet < m_versInterne.size() ? m_versInterne[p_sommet] : p_sommet;
+}
+
+//! \brief		Numéro externe d'un numéro de sommet interne
+template<typename T,typename N>
+inline unsigned int Graphe<T,N>::externe(unsigned int p_sommet) const
+{
+	return p_sommet < m_versExterne.size() ? m_versExterne[p_sommet] : p_sommet;
+}
+
+//! \brief		Remplace, sur place, des numéros internes par les numéros externes
+template<typename T,typename N>
+void Graphe<T,N>::versExterne(std::vector<unsigned int> & p_sommets) const
+{
+	if (m_versExterne.empty())
+		return;
+	for (unsigned int i = 0; i < p_sommets.size(); ++i)
+		p_sommets[i] = m_versExterne[p_sommets[i]];
+}
+
+//! \brief		Numéros internes d'une liste de sommets externes
+//! \param[out]	p_internes reçoit les numéros internes si le graphe est renuméroté
+//! \return		p_sommets lui-même si le graphe n'est pas renuméroté, p_internes sinon
+template<typename T,typename N>
+const std::vector<unsigned int> & Graphe<T,N>::versInterne(const std::vector<unsigned int> & p_sommets,
+		std::vector<unsigned int> & p_internes) const
+{
+	if (m_versInterne.empty())
+		return p_sommets;
+	p_internes.resize(p_sommets.size());
+	for (unsigned int i = 0; i < p_sommets.size(); ++i)
+	{
+		PRECONDITION( p_sommets[i] < m_nbSommets);
+		p_internes[i] = m_versInterne[p_sommets[i]];
+	}
+	return p_internes;
+}
+
+//! \brief		Range une table calculée dans l'ordre interne selon les numéros externes
+//! \brief		(rangées et colonnes permutées, prédécesseurs traduits)
+template<typename T,typename N>
+void Graphe<T,N>::tableVersExterne(TableDistances<N> & p_table) const
+{
+	if (m_versExterne.empty() || m_nbSommets == 0)
+		return;
+
+	const size_t n = m_nbSommets;
+	std::vector<N> distances(p_table.reqRangeeDistances(0), p_table.reqRangeeDistances(0) + n * n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		N * rangee = p_table.reqRangeeDistances(m_versExterne[i]);
+		for (size_t j = 0; j < n; ++j)
+			rangee[m_versExterne[j]] = distances[i * n + j];
+	}
+
+	if (p_table.reqRangeePredecesseurs(0) == 0)
+		return;
+	std::vector<unsigned int> predecesseurs(p_table.reqRangeePredecesseurs(0), p_table.reqRangeePredecesseurs(0) + n * n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		unsigned int * rangee = p_table.reqRangeePredecesseurs(m_versExterne[i]);
+		for (size_t j = 0; j < n; ++j)
+		{
+			unsigned int predecesseur = predecesseurs[i * n + j];
+			rangee[m_versExterne[j]] = predecesseur < n ? m_versExterne[predecesseur] : predecesseur;
+		}
+	}
+}
+
+//! \brief		Indique si les sommets sont rangés dans un autre ordre que celui d'origine
+template<typename T,typename N>
+bool Graphe<T,N>::estRenumerote() const
+{
+	return !m_versExterne.empty();
+}
+
+//! \brief		Obtient le numéro interne d'un sommet, celui de reqArcs(), des repères, profils et hiérarchies
+template<typename T,typename N>
+unsigned int Graphe<T,N>::reqInterne(unsigned int p_sommet) const
+{
+	PRECONDITION( p_sommet < m_nbSommets);
+	return interne(p_sommet);
+}
+
+//! \brief		Obtient le numéro externe (celui d'origine) d'un numéro de sommet interne
+template<typename T,typename N>
+unsigned int Graphe<T,N>::reqExterne(unsigned int p_sommet) const
+{
+	PRECONDITION( p_sommet < m_nbSommets);
+	return externe(p_sommet);
+}
+
+//! \brief		Range les sommets en mémoire dans un nouvel ordre; les numéros externes ne changent pas
+//! \brief		les arcs, les noms et la matrice de valuation (libérée) suivent les sommets
+//! \param[in]	p_ordre les numéros externes de tous les sommets, dans l'ordre où les ranger
+//! \pre		le graphe doit être figé et p_ordre doit être une permutation des sommets
+//! \note		les repères, profils et hiérarchies déjà construits sur ce graphe ne sont plus valides
+template<typename T,typename N>
+void Graphe<T,N>::renumeroter(const std::vector<unsigned int> & p_ordre)
+{
+	PRECONDITION( estFige());
+	PRECONDITION( p_ordre.size() == m_nbSommets);
+	const unsigned int AUCUN = ReserveNoms<T>::AUCUN;
+
+	//nouveau[i] est le rang du sommet interne i dans le nouvel ordre
+	std::vector<unsigned int> nouveau(m_nbSommets, AUCUN);
+	for (unsigned int k = 0; k < m_nbSommets; ++k)
+	{
+		PRECONDITION( p_ordre[k] < m_nbSommets);
+		unsigned int & rang = nouveau[interne(p_ordre[k])];
+		PRECONDITION( rang == AUCUN);
+		rang = k;
+	}
+
+	std::vector<arc> tousLesArcs;
+	m_arcs.listerArcs(tousLesArcs);
+	for (unsigned int k = 0; k < tousLesArcs.size(); ++k)
+	{
+		tousLesArcs[k].origine = nouveau[tousLesArcs[k].origine];
+		tousLesArcs[k].destination = nouveau[tousLesArcs[k].destination];
+	}
+	m_arcs = GrapheCSR<N>(m_nbSommets, tousLesArcs);
+	m_arcsInverses = m_arcs.transposer();
+
+	//les listes de sommets de même nom sont refaites en ordre décroissant pour rester croissantes
+	std::vector<unsigned int> noms(m_nbSommets);
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+		noms[nouveau[i]] = m_noms[i];
+	m_premierDuNom.assign(m_premierDuNom.size(), AUCUN);
+	for (unsigned int i = m_nbSommets; i-- > 0;)
+		lierNom(i, noms[i]);
+
+	m_versInterne.resize(m_nbSommets);
+	m_versExterne.assign(p_ordre.begin(), p_ordre.end());
+	for (unsigned int k = 0; k < m_nbSommets; ++k)
+		m_versInterne[p_ordre[k]] = k;
+
+	std::vector<N, AllocateurAligne<N> >().swap(m_matrice);
+	++m_version;
+}
+
+//! \brief		Parcours en largeur sans tenir compte du sens des arcs, composante par composante
+//! \param[in]	p_parDegre si vrai, les voisins et les racines sont pris par degré croissant (Cuthill-McKee)
+//! \param[out]	p_ordre les numéros externes des sommets dans l'ordre de visite
+template<typename T,typename N>
+void Graphe<T,N>::parcoursLargeur(bool p_parDegre, std::vector<unsigned int> & p_ordre) const
+{
+	PRECONDITION( estFige());
+	std::vector<unsigned int> degres(m_nbSommets);
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+		degres[i] = m_arcs.reqFin(i) - m_arcs.reqDebut(i) + m_arcsInverses.reqFin(i) - m_arcsInverses.reqDebut(i);
+
+	std::vector< std::pair<unsigned int, unsigned int> > racines;
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+		racines.push_back(std::make_pair(p_parDegre ? degres[i] : 0, i));
+	if (p_parDegre)
+		std::sort(racines.begin(), racines.end());
+
+	std::vector<bool> estVu(m_nbSommets, false);
+	std::vector< std::pair<unsigned int, unsigned int> > voisins;
+	p_ordre.clear();
+	p_ordre.reserve(m_nbSommets);
+	for (unsigned int r = 0; r < racines.size(); ++r)
+	{
+		if (estVu[racines[r].second])
+			continue;
+		estVu[racines[r].second] = true;
+		size_t tete = p_ordre.size();
+		p_ordre.push_back(racines[r].second);
+		for (; tete < p_ordre.size(); ++tete)
+		{
+			const unsigned int sommet = p_ordre[tete];
+			voisins.clear();
+			for (unsigned int k = m_arcs.reqDebut(sommet); k < m_arcs.reqFin(sommet); ++k)
+				voisins.push_back(std::make_pair(p_parDegre ? degres[m_arcs.reqDestination(k)] : 0, m_arcs.reqDestination(k)));
+			for (unsigned int k = m_arcsInverses.reqDebut(sommet); k < m_arcsInverses.reqFin(sommet); ++k)
+				voisins.push_back(std::make_pair(p_parDegre ? degres[m_arcsInverses.reqDestination(k)] : 0, m_arcsInverses.reqDestination(k)));
+			if (p_parDegre)
+				std::sort(voisins.begin(), voisins.end());
+			for (unsigned int v = 0; v < voisins.size(); ++v)
+			{
+				if (estVu[voisins[v].second])
+					continue;
+				estVu[voisins[v].second] = true;
+				p_ordre.push_back(voisins[v].second);
+			}
+		}
+	}
+	versExterne(p_ordre);
+}
+
+//! \brief		Ordre de parcours en largeur, à passer à renumeroter()
+//! \brief		les sommets voisins reçoivent des numéros internes proches
+template<typename T,typename N>
+void Graphe<T,N>::ordreLargeur(std::vector<unsigned int> & p_ordre) const
+{
+	parcoursLargeur(false, p_ordre);
+}
 
+//! \brief		Ordre de Cuthill-McKee inversé, à passer à renumeroter()
+//! \brief		comme ordreLargeur(), mais en visitant les voisins de plus petit degré en premier,
+//! \brief		ce qui réduit la largeur de bande |i - j| des arcs
+template<typename T,typename N>
+void Graphe<T,N>::ordreCuthillMcKee(std::vector<unsigned int> & p_ordre) const
+{
+	parcoursLargeur(true, p_ordre);
+	std::reverse(p_ordre.begin(), p_ordre.end());
+}
+
+//! \brief		Alloue et remplit la matrice de valuation si ce n'est pas déjà fait
+//! \brief		0 dans la diagonale, le poids de l'arc s'il existe et infini ailleurs
+//! \note		la matrice est mutable: la première construction n'est pas protégée contre les appels concurrents
+template<typename T,typename N>
+void Graphe<T,N>::construireMatrice() const
+{
+	if (!m_matrice.empty() || m_nbSommets == 0)
+		return;
 
+	m_matrice.assign(m_nbSommets * m_nbSommets, numeric_limits<N>::max());
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+	{
+		m_matrice[i * m_nbSommets + i] = 0;
+		for (unsigned int k = m_arcs.reqDebut(i); k < m_arcs.reqFin(i); ++k)
+			m_matrice[i * m_nbSommets + m_arcs.reqDestination(k)] = m_arcs.reqPoids(k);
+	}
 }
 
 //! \brief Algorithme de Dijkstra permettant de trouver le plus court chemin entre p_origine et p_destination
@@ -106,7 +511,13 @@ N Graphe<T,N>::dijkstra(const unsigned int & p_origine, const unsigned int & p_d
 		std::vector< std::pair<unsigned int, T> > & p_chemin) const
 {
 	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+	INSTRUMENTER_REQUETE("dijkstra");
 
+	INSTRUMENTER_PHASE(phase, "dijkstra: matrice");
+	construireMatrice();
+	INSTRUMENTER_ENCHAINER(phase, "dijkstra: initialisation");
 	vector<N> distance(m_nbSommets);
 	vector<unsigned int> predecesseur(m_nbSommets);
 	vector<bool> estNonSolutionne(m_nbSommets);
@@ -116,13 +527,15 @@ N Graphe<T,N>::dijkstra(const unsigned int & p_origine, const unsigned int & p_d
 		predecesseur[i] = numeric_limits<unsigned int>::max(); //indique l'absence d'un prédécesseur
 		estNonSolutionne[i] = true;
 	}
-	distance[p_origine] = 0;
+	distance[origine] = 0;
 
 	list<unsigned int> sommetsNonSolutionnes;
 	for (unsigned int i = 0; i < m_nbSommets; ++i)
 		sommetsNonSolutionnes.push_back(i);
+	INSTRUMENTER_AMELIORATION(true);
 
 	//Boucle principale: touver distance[] et predecesseur[]
+	INSTRUMENTER_ENCHAINER(phase, "dijkstra: recherche");
 	for (unsigned int cpt = 0; cpt < m_nbSommets; ++cpt)
 	{
 		list<unsigned int>::iterator uStarItr;
@@ -147,17 +560,21 @@ N Graphe<T,N>::dijkstra(const unsigned int & p_origine, const unsigned int & p_d
 
 		if(distance[uStar]==numeric_limits<N>::max())
 			break; //terminer dijkstra car p_destination n'est pas accessible de p_source
+		INSTRUMENTER_SOLUTIONNE();
 
-		if(uStar==p_destination)
+		if(uStar==destination)
 			break; //terminer dijkstra car on a solutionné p_destination
 
+		const N * rangeeUStar = &m_matrice[uStar * m_nbSommets];
 		for(unsigned int u=0; u<m_nbSommets; ++u)
 		{
-			if(m_matrice[uStar][u]!=numeric_limits<N>::max() && u!=uStar && estNonSolutionne[u])
+			if(rangeeUStar[u]!=numeric_limits<N>::max() && u!=uStar && estNonSolutionne[u])
 			{
-				N temp = distance[uStar] + m_matrice[uStar][u];
+				INSTRUMENTER_RELACHE();
+				N temp = distance[uStar] + rangeeUStar[u];
 				if (temp < distance[u])
 				{
+					INSTRUMENTER_AMELIORATION(distance[u] == numeric_limits<N>::max());
 					distance[u] = temp;
 					predecesseur[u] = uStar;
 				}
@@ -166,9 +583,10 @@ N Graphe<T,N>::dijkstra(const unsigned int & p_origine, const unsigned int & p_d
 	}
 
 	//Construire le plus court chemin à l'aide de predecesseur[]
+	INSTRUMENTER_ENCHAINER(phase, "dijkstra: chemin");
 	p_chemin.clear();
 	stack<unsigned int> pileDuChemin;
-	unsigned int numero = p_destination;
+	unsigned int numero = destination;
 	pileDuChemin.push(numero);
 	while(predecesseur[numero]!= numeric_limits<unsigned int>::max())
 	{
@@ -177,102 +595,1683 @@ N Graphe<T,N>::dijkstra(const unsigned int & p_origine, const unsigned int & p_d
 	}
 	while(!pileDuChemin.empty())
 	{
-		p_chemin.push_back( pair<unsigned int, T>(pileDuChemin.top(), reqNom(pileDuChemin.top())) );
+		p_chemin.push_back( pair<unsigned int, T>(externe(pileDuChemin.top()), m_reserveNoms.reqNom(m_noms[pileDuChemin.top()])) );
 		pileDuChemin.pop();
 	}
 
     //cas où l'on n'a pas de solution
-	if (predecesseur[p_destination] == numeric_limits<unsigned int>::max()
-            && p_destination != p_origine)
+	if (predecesseur[destination] == numeric_limits<unsigned int>::max()
+            && destination != origine)
         return numeric_limits<N>::max();
 
-	return distance[p_destination];
+	return distance[destination];
 }
 
-//! \brief Algorithme de Dijkstra permettant de trouver le plus court chemin entre p_origine et p_destination
+//! \brief Algorithme de Dijkstra en O(n^2) sur la matrice d'adjacence
 //! \pre p_origine et p_destination doivent être des sommets du graphe
-//! \param[out] la longueur du plus court chemin est retournée
 //! \param[out] le chemin est retourné
 //! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note un contexte temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
 template<typename T,typename N>
-N Graphe<T,N>::dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
-		std::vector< std::pair<unsigned int, T> > & p_chemin) const
+N Graphe<T,N>::dijkstraDense(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin) const
 {
-	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	ContexteDense<N> contexte;
+	return dijkstraDense(p_origine, p_destination, p_chemin, contexte);
+}
 
-	std::vector<unsigned int> predecesseur;
-	std::vector<N> distance_minimum;
-	
-	this->DijkstraCalculerChemins(p_origine, distance_minimum, predecesseur);
+//! \brief Algorithme de Dijkstra en O(n^2) sur la matrice d'adjacence, sans file de priorité
+//! \brief chaque itération cherche le minimum des clés puis relaxe toute la rangée du sommet solutionné,
+//! \brief deux balayages contigus vectorisés (voir ContexteDense); plus rapide que dijkstraV2() quand le
+//! \brief graphe est petit ou dense, c'est-à-dire quand un sommet a une bonne part des n arcs possibles
+//! \brief la recherche s'arrête dès que p_destination est solutionné
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] le chemin est retourné
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note la matrice est construite au premier appel: l'appeler une fois avant de chercher depuis plusieurs fils
+template<typename T,typename N>
+N Graphe<T,N>::dijkstraDense(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin, ContexteDense<N> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
 
-	std::stack<unsigned int> pileDuChemin;
-	for (unsigned int sommetPrecedent = p_destination;sommetPrecedent != std::numeric_limits<unsigned int>::max(); sommetPrecedent =  predecesseur[sommetPrecedent])
+	construireMatrice();
+	p_contexte.preparer(m_nbSommets, origine);
+	for (;;)
 	{
-		pileDuChemin.push(sommetPrecedent);
+		N distance;
+		unsigned int uStar = p_contexte.solutionnerMinimum(distance);
+		if (uStar == numeric_limits<unsigned int>::max() || uStar == destination)
+			break;
+		p_contexte.relaxer(uStar, &m_matrice[(size_t) uStar * m_nbSommets]);
 	}
 
-	while(!pileDuChemin.empty())
+	p_chemin.m_graphe = this;
+	p_chemin.m_sommets.clear();
+	if (!p_contexte.estSolutionne(destination))
 	{
-		p_chemin.push_back( pair<unsigned int, T>(pileDuChemin.top(), reqNom(pileDuChemin.top())) );
-		pileDuChemin.pop();
+		p_chemin.m_longueur = numeric_limits<N>::max();
+		return p_chemin.m_longueur;
 	}
+	for (unsigned int sommet = destination; sommet != numeric_limits<unsigned int>::max();
+			sommet = p_contexte.reqPredecesseur(sommet))
+		p_chemin.m_sommets.push_back(sommet);
+	std::reverse(p_chemin.m_sommets.begin(), p_chemin.m_sommets.end());
+	versExterne(p_chemin.m_sommets);
+	p_chemin.m_longueur = p_contexte.reqDistance(destination);
+	return p_chemin.m_longueur;
+}
+
+//! \brief Algorithme de Dijkstra permettant de trouver le plus court chemin entre p_origine et p_destination
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] la longueur du plus court chemin est retournée
+//! \param[out] le chemin est retourné
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note FilePriorite est la politique de file de priorité (voir FilePriorite.h)
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
+		std::vector< std::pair<unsigned int, T> > & p_chemin) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	return dijkstraV2(p_origine, p_destination, p_chemin, contexte);
+}
+
+//! \brief Algorithme de Dijkstra permettant de trouver le plus court chemin entre p_origine et p_destination
+//! \brief la recherche s'arrête dès que p_destination est solutionné
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] le chemin est retourné
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
+		std::vector< std::pair<unsigned int, T> > & p_chemin,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	Chemin<T, N> chemin;
+	dijkstraV2(p_origine, p_destination, chemin, p_contexte);
+	chemin.exporter(p_chemin);
+	return chemin.reqLongueur();
+}
+
+//! \brief Algorithme de Dijkstra permettant de trouver le plus court chemin entre p_origine et p_destination
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] p_chemin les sommets du chemin et sa longueur; les noms ne sont pas copiés
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	return dijkstraV2(p_origine, p_destination, p_chemin, contexte);
+}
+
+//! \brief Algorithme de Dijkstra permettant de trouver le plus court chemin entre p_origine et p_destination
+//! \brief la recherche s'arrête dès que p_destination est solutionné
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] p_chemin les sommets du chemin et sa longueur; les noms ne sont pas copiés
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraV2(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+	INSTRUMENTER_REQUETE("dijkstraV2");
+
+	INSTRUMENTER_PHASE(phase, "dijkstraV2: recherche");
+	this->DijkstraCalculerChemins(origine, destination, p_contexte);
+	INSTRUMENTER_ENCHAINER(phase, "dijkstraV2: chemin");
+	p_chemin.m_graphe = this;
+	construireChemin(destination, p_contexte, p_chemin.m_sommets);
+	versExterne(p_chemin.m_sommets);
 
 	//cas où l'on n'a pas de solution
-	if (predecesseur[p_destination] == numeric_limits<unsigned int>::max()
-	       && p_destination != p_origine)
-		return numeric_limits<N>::max();
+	p_chemin.m_longueur = p_contexte.estAtteint(destination) ? p_contexte.reqDistance(destination) : numeric_limits<N>::max();
+	return p_chemin.m_longueur;
+}
 
-	return distance_minimum[p_destination];
+//! \brief Recherche bidirectionnelle du plus court chemin entre p_origine et p_destination
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] le chemin est retourné
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note deux contextes de recherche temporaires sont alloués: utiliser la surcharge avec contextes pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraBidirectionnel(const unsigned int & p_origine, const unsigned int & p_destination,
+		std::vector< std::pair<unsigned int, T> > & p_chemin) const
+{
+	ContexteRecherche<N, FilePriorite> contexteAvant;
+	ContexteRecherche<N, FilePriorite> contexteArriere;
+	return dijkstraBidirectionnel(p_origine, p_destination, p_chemin, contexteAvant, contexteArriere);
 }
 
+//! \brief Recherche bidirectionnelle du plus court chemin entre p_origine et p_destination
+//! \brief une recherche avant depuis p_origine (arcs sortants) et une recherche arrière depuis p_destination
+//! \brief (arcs entrants) solutionnent un sommet à tour de rôle. Chaque arc examiné qui relie les deux
+//! \brief recherches donne un chemin candidat; la meilleure longueur trouvée, mu, est optimale dès que
+//! \brief la somme des dernières distances solutionnées de part et d'autre atteint mu.
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] le chemin est retourné
+//! \param[in,out] p_contexteAvant l'espace de travail de la recherche avant
+//! \param[in,out] p_contexteArriere l'espace de travail de la recherche arrière
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note la longueur est toujours celle de dijkstraV2; entre plusieurs plus courts chemins de même
+//! \note longueur, le chemin retourné peut différer
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraBidirectionnel(const unsigned int & p_origine, const unsigned int & p_destination,
+		std::vector< std::pair<unsigned int, T> > & p_chemin,
+		ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+		ContexteRecherche<N, FilePriorite> & p_contexteArriere) const
+{
+	Chemin<T, N> chemin;
+	dijkstraBidirectionnel(p_origine, p_destination, chemin, p_contexteAvant, p_contexteArriere);
+	chemin.exporter(p_chemin);
+	return chemin.reqLongueur();
+}
 
-//! \brief Algorithme de Dijkstra permettant de trouver tous les plus petits chemins d'un point d'origine p_origine.
-//! \param[in] p_origine l'index d'un sommet du graphe.
-//! \param[out] p_distance_minimum Un vecteur de taille qui représente la longueur du plus petit chemin du sommet d'origine au sommet à l'index.
-//! \param[out] p_predecesseur Un vecteur d'index qui représente l'index du sommet précédent l'index dans son chemin le plus court du point d'origine
-//! \pre p_origine doit être un sommet du graph
-//! \note C'est algorithme est une version franciser de celui disponible au http://rosettacode.org/wiki/Dijkstra's_algorithm#C.2B.2B
+//! \brief Recherche bidirectionnelle du plus court chemin entre p_origine et p_destination
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] p_chemin les sommets du chemin et sa longueur; les noms ne sont pas copiés
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note deux contextes de recherche temporaires sont alloués: utiliser la surcharge avec contextes pour des requêtes répétées
 template<typename T,typename N>
-void Graphe<T,N>::DijkstraCalculerChemins(unsigned int p_origine,
-		std::vector<N>& p_distance_minimum,
-		std::vector<unsigned int>& p_predecesseur) const
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraBidirectionnel(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin) const
 {
-	PRECONDITION( p_origine < m_nbSommets);
-	int tailleListeVoisin = m_listeVoisin.size();
-	p_distance_minimum.clear();
-	p_distance_minimum.resize(tailleListeVoisin, std::numeric_limits<N>::max());
-	p_distance_minimum[p_origine] = 0;
-
-	p_predecesseur.clear();
-	p_predecesseur.resize(tailleListeVoisin, std::numeric_limits<unsigned int>::max());
-	std::set< std::pair<N, unsigned int> > lesArcsARegarder;
-	lesArcsARegarder.insert(std::make_pair(p_distance_minimum[p_origine], p_origine));
-	
-	while (!lesArcsARegarder.empty())
+	ContexteRecherche<N, FilePriorite> contexteAvant;
+	ContexteRecherche<N, FilePriorite> contexteArriere;
+	return dijkstraBidirectionnel(p_origine, p_destination, p_chemin, contexteAvant, contexteArriere);
+}
+
+//! \brief Recherche bidirectionnelle du plus court chemin entre p_origine et p_destination
+//! \brief voir la surcharge avec std::vector pour la description de l'algorithme
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] p_chemin les sommets du chemin et sa longueur; les noms ne sont pas copiés
+//! \param[in,out] p_contexteAvant l'espace de travail de la recherche avant
+//! \param[in,out] p_contexteArriere l'espace de travail de la recherche arrière
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraBidirectionnel(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin,
+		ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+		ContexteRecherche<N, FilePriorite> & p_contexteArriere) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+
+	const unsigned int AUCUN = numeric_limits<unsigned int>::max();
+	p_contexteAvant.preparer(m_nbSommets, m_arcs.reqPoidsMax());
+	p_contexteArriere.preparer(m_nbSommets, m_arcs.reqPoidsMax());
+	p_contexteAvant.fixer(origine, 0, AUCUN);
+	p_contexteArriere.fixer(destination, 0, AUCUN);
+	p_contexteAvant.reqFile().insererOuDiminuer(origine, 0);
+	p_contexteArriere.reqFile().insererOuDiminuer(destination, 0);
+
+	N meilleure = origine == destination ? 0 : numeric_limits<N>::max(); //mu
+	unsigned int milieuAvant = origine;      //dernier sommet du meilleur chemin du côté avant
+	unsigned int milieuArriere = destination; //premier sommet du meilleur chemin du côté arrière
+	N derniereAvant = 0;
+	N derniereArriere = 0;
+	bool sensAvant = true;
+
+	while (!p_contexteAvant.reqFile().estVide() && !p_contexteArriere.reqFile().estVide()
+			&& (meilleure == numeric_limits<N>::max() || derniereAvant + derniereArriere < meilleure))
 	{
-		//Obtenir le sommet du première arcs.
-		N distance = lesArcsARegarder.begin()->first;
-		unsigned int sommet = lesArcsARegarder.begin()->second;
-		lesArcsARegarder.erase(lesArcsARegarder.begin());
-		
-		//Visite chaque arc sortant du sommet;
-		const std::vector<voisin>& vecteurVoisins = m_listeVoisin[sommet];
+		ContexteRecherche<N, FilePriorite> & contexte = sensAvant ? p_contexteAvant : p_contexteArriere;
+		const ContexteRecherche<N, FilePriorite> & contexteOppose = sensAvant ? p_contexteArriere : p_contexteAvant;
+		const GrapheCSR<N> & arcs = sensAvant ? m_arcs : m_arcsInverses;
+
+		N distance;
+		unsigned int sommet = contexte.reqFile().extraireMin(distance);
+		(sensAvant ? derniereAvant : derniereArriere) = distance;
+		if (meilleure != numeric_limits<N>::max() && !(derniereAvant + derniereArriere < meilleure))
+			break; //aucun chemin passant par ce sommet ne peut améliorer mu
 
-		for(typename std::vector<voisin>::const_iterator iter_voisin = vecteurVoisins.begin(); iter_voisin != vecteurVoisins.end(); iter_voisin++)
+		for (unsigned int k = arcs.reqDebut(sommet), fin = arcs.reqFin(sommet); k < fin; ++k)
 		{
-			unsigned int unVoisin = iter_voisin->destination;
-			N poidsVoisin = iter_voisin->poids;
-			N poidsTotalVoisin = distance+poidsVoisin;
-			if (poidsTotalVoisin < p_distance_minimum[unVoisin])
+			unsigned int unVoisin = arcs.reqDestination(k);
+			N poidsTotalVoisin = distance + arcs.reqPoids(k);
+			if (poidsTotalVoisin < contexte.reqDistance(unVoisin))
 			{
-				lesArcsARegarder.erase(std::make_pair(p_distance_minimum[unVoisin], unVoisin));
-
-				p_distance_minimum[unVoisin] = poidsTotalVoisin;
-				p_predecesseur[unVoisin] = sommet;
-				lesArcsARegarder.insert(std::make_pair(p_distance_minimum[unVoisin], unVoisin));
+				contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				contexte.reqFile().insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+			if (contexteOppose.estAtteint(unVoisin))
+			{
+				N candidat = poidsTotalVoisin + contexteOppose.reqDistance(unVoisin);
+				if (candidat < meilleure)
+				{
+					meilleure = candidat;
+					milieuAvant = sensAvant ? sommet : unVoisin;
+					milieuArriere = sensAvant ? unVoisin : sommet;
+				}
 			}
 		}
+		sensAvant = !sensAvant;
+	}
+
+	p_chemin.m_graphe = this;
+	p_chemin.m_longueur = meilleure;
+	std::vector<unsigned int> & sommets = p_chemin.m_sommets;
+	sommets.clear();
+	if (meilleure == numeric_limits<N>::max())
+	{
+		sommets.push_back(p_destination);
+		return meilleure;
+	}
+
+	for (unsigned int sommet = milieuAvant; sommet != AUCUN; sommet = p_contexteAvant.reqPredecesseur(sommet))
+		sommets.push_back(sommet);
+	std::reverse(sommets.begin(), sommets.end());
+	if (milieuArriere != milieuAvant)
+		for (unsigned int sommet = milieuArriere; sommet != AUCUN; sommet = p_contexteArriere.reqPredecesseur(sommet))
+			sommets.push_back(sommet);
+	versExterne(sommets);
+
+	return meilleure;
+}
+
+//! \brief Plus court chemin de p_origine à p_destination, à partir de l'arbre de p_origine gardé en cache
+//! \pre p_origine et p_destination sont des sommets du graphe; le graphe est figé
+//! \return la longueur du chemin (= numeric_limits<N>::max() si aucun chemin)
+//! \note un contexte de recherche temporaire est alloué à chaque échec: utiliser la surcharge avec contexte
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraEnCache(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin, CacheArbres<N> & p_cache) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	return dijkstraEnCache(p_origine, p_destination, p_chemin, p_cache, contexte);
+}
+
+//! \brief Plus court chemin de p_origine à p_destination, à partir de l'arbre de p_origine gardé en cache
+//! \brief si l'arbre de p_origine n'est pas dans p_cache (ou date d'une autre version du graphe), il est calculé
+//! \brief au complet dans p_contexte et rangé dans le cache; sinon, seul le chemin est reconstruit
+//! \pre p_origine et p_destination sont des sommets du graphe; le graphe est figé
+//! \param[in,out] p_cache le cache des arbres, qui peut être partagé par plusieurs fils d'exécution
+//! \param[in,out] p_contexte l'espace de travail des recherches complètes (un par fil d'exécution)
+//! \return la longueur du chemin (= numeric_limits<N>::max() si aucun chemin)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraEnCache(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin, CacheArbres<N> & p_cache,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+
+	typedef typename CacheArbres<N>::arbre arbre;
+	std::shared_ptr<const arbre> lArbre = p_cache.trouver(origine, m_version);
+	if (!lArbre)
+	{
+		std::shared_ptr<arbre> nouvelArbre = std::make_shared<arbre>();
+		DijkstraCalculerChemins(origine, numeric_limits<unsigned int>::max(), p_contexte);
+		p_contexte.exporter(nouvelArbre->distances, nouvelArbre->predecesseurs);
+		p_cache.inserer(origine, m_version, nouvelArbre);
+		lArbre = nouvelArbre;
 	}
 
+	p_chemin.m_graphe = this;
+	p_chemin.m_sommets.clear();
+	for (unsigned int sommet = destination; sommet != numeric_limits<unsigned int>::max(); sommet = lArbre->predecesseurs[sommet])
+		p_chemin.m_sommets.push_back(sommet);
+	std::reverse(p_chemin.m_sommets.begin(), p_chemin.m_sommets.end());
+	versExterne(p_chemin.m_sommets);
+	p_chemin.m_longueur = lArbre->distances[destination];
+	return p_chemin.m_longueur;
 }
 
+//! \brief Plus court chemin d'un groupe d'origines vers un groupe de destinations
+//! \pre les deux groupes sont non vides et ne contiennent que des sommets du graphe
+//! \param[out] p_chemin le chemin, de l'origine retenue à la destination retenue
+//! \return la longueur du chemin (= numeric_limits<N>::max() si aucune destination n'est atteignable)
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraGroupes(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+		Chemin<T, N> & p_chemin) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	return dijkstraGroupes(p_origines, p_destinations, p_chemin, contexte);
+}
+
+//! \brief Plus court chemin d'un groupe d'origines vers un groupe de destinations
+//! \brief une seule recherche de Dijkstra, dont toutes les origines sont placées à distance 0;
+//! \brief la recherche s'arrête dès qu'une destination est solutionnée, et c'est la plus proche.
+//! \brief Remplace les |origines| x |destinations| recherches d'un sommet vers un sommet.
+//! \pre les deux groupes sont non vides et ne contiennent que des sommets du graphe
+//! \param[out] p_chemin le chemin; son premier sommet est l'origine retenue et son dernier, la destination retenue
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+//! \return la longueur du chemin (= numeric_limits<N>::max() si aucune destination n'est atteignable)
+//! \note si aucune destination n'est atteignable, p_chemin ne contient que la première destination
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraGroupes(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+		Chemin<T, N> & p_chemin,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( !p_origines.empty() && !p_destinations.empty());
+	PRECONDITION( estFige());
+
+	//les groupes sont petits (les quais d'une station): une recherche dichotomique suffit
+	PRECONDITION( *std::max_element(p_destinations.begin(), p_destinations.end()) < m_nbSommets);
+	std::vector<unsigned int> internes;
+	std::vector<unsigned int> destinations(versInterne(p_destinations, internes));
+	std::sort(destinations.begin(), destinations.end());
+
+	p_contexte.preparer(m_nbSommets, m_arcs.reqPoidsMax());
+	FilePriorite & lesSommetsARegarder = p_contexte.reqFile();
+	for (std::vector<unsigned int>::const_iterator itr = p_origines.begin(); itr != p_origines.end(); ++itr)
+	{
+		PRECONDITION( *itr < m_nbSommets);
+		p_contexte.fixer(interne(*itr), 0, numeric_limits<unsigned int>::max());
+		lesSommetsARegarder.insererOuDiminuer(interne(*itr), 0);
+	}
+
+	unsigned int atteinte = numeric_limits<unsigned int>::max();
+	while (!lesSommetsARegarder.estVide())
+	{
+		N distance;
+		unsigned int sommet = lesSommetsARegarder.extraireMin(distance);
+		if (std::binary_search(destinations.begin(), destinations.end(), sommet))
+		{
+			atteinte = sommet;
+			break;
+		}
+
+		for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = m_arcs.reqDestination(k);
+			N poidsTotalVoisin = distance + m_arcs.reqPoids(k);
+			if (poidsTotalVoisin < p_contexte.reqDistance(unVoisin))
+			{
+				p_contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				lesSommetsARegarder.insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+		}
+	}
+
+	p_chemin.m_graphe = this;
+	if (atteinte == numeric_limits<unsigned int>::max())
+	{
+		p_chemin.m_sommets.assign(1, p_destinations.front());
+		p_chemin.m_longueur = numeric_limits<N>::max();
+	}
+	else
+	{
+		construireChemin(atteinte, p_contexte, p_chemin.m_sommets);
+		versExterne(p_chemin.m_sommets);
+		p_chemin.m_longueur = p_contexte.reqDistance(atteinte);
+	}
+	return p_chemin.m_longueur;
+}
+
+//! \brief Plus court chemin entre deux stations désignées par leur nom
+//! \brief tous les sommets qui portent le nom de la station (ses quais) sont des origines ou des destinations
+//! \pre les deux noms doivent être portés par au moins un sommet
+//! \param[out] p_chemin le chemin; ses extrémités sont les quais retenus
+//! \return la longueur du chemin (= numeric_limits<N>::max() si la station p_destination n'est pas atteignable)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraStations(const T & p_origine, const T & p_destination, Chemin<T, N> & p_chemin) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	return dijkstraStations(p_origine, p_destination, p_chemin, contexte);
+}
+
+//! \brief Plus court chemin entre deux stations désignées par leur nom
+//! \pre les deux noms doivent être portés par au moins un sommet
+//! \param[out] p_chemin le chemin; ses extrémités sont les quais retenus
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+//! \return la longueur du chemin (= numeric_limits<N>::max() si la station p_destination n'est pas atteignable)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraStations(const T & p_origine, const T & p_destination, Chemin<T, N> & p_chemin,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	std::vector<unsigned int> origines;
+	std::vector<unsigned int> destinations;
+	trouverSommets(p_origine, origines);
+	trouverSommets(p_destination, destinations);
+	return dijkstraGroupes(origines, destinations, p_chemin, p_contexte);
+}
+
+//! \brief Indique si l'arc i -> j est une correspondance, c'est-à-dire s'il relie deux sommets de même nom
+template<typename T,typename N>
+bool Graphe<T,N>::estCorrespondance(unsigned int i, unsigned int j) const
+{
+	PRECONDITION( i < m_nbSommets && j < m_nbSommets);
+	return m_noms[interne(i)] == m_noms[interne(j)];
+}
+
+//! \brief Compte les correspondances d'un chemin de ce graphe
+template<typename T,typename N>
+unsigned int Graphe<T,N>::compterCorrespondances(const Chemin<T, N> & p_chemin) const
+{
+	unsigned int nb = 0;
+	for (size_t i = 1; i < p_chemin.reqNbSommets(); ++i)
+		if (estCorrespondance(p_chemin.reqSommet(i - 1), p_chemin.reqSommet(i)))
+			++nb;
+	return nb;
+}
+
+//! \brief Plus court chemin où l'attente n'est comptée qu'à la montée et aux correspondances
+//! \pre p_origine et p_destination sont des sommets du graphe; le graphe est figé
+//! \pre FileDial n'est pas utilisable avec p_moinsDeCorrespondances (voir la surcharge avec contexte)
+//! \return la durée du chemin (= numeric_limits<N>::max() si aucun chemin)
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraCorrespondances(const unsigned int & p_origine, const unsigned int & p_destination, N p_attente,
+		bool p_moinsDeCorrespondances, Chemin<T, N> & p_chemin) const
+{
+	ContexteRecherche<unsigned long long, FilePriorite> contexte;
+	return dijkstraCorrespondances(p_origine, p_destination, p_attente, p_moinsDeCorrespondances, p_chemin, contexte);
+}
+
+//! \brief Plus court chemin où l'attente n'est comptée qu'à la montée et aux correspondances
+//! \brief chaque sommet est un quai (une station sur une ligne): rester sur le quai d'arrivée, c'est rester
+//! \brief dans la rame. Le poids de chaque arc comprend déjà p_attente (comme ajouté par chargerGrapheTexte());
+//! \brief il est retiré des arcs de trajet, sauf de ceux qui quittent l'origine (la montée). Une correspondance
+//! \brief garde son attente: elle mène au quai d'une autre ligne. Le coût d'un arc ne dépend que de sa classe
+//! \brief et de son origine, de sorte que l'état (sommet, ligne) se réduit au sommet.
+//! \brief Avec p_moinsDeCorrespondances, la clé est lexicographique: nombre de correspondances * 2^32 + durée.
+//! \pre p_origine et p_destination sont des sommets du graphe; le graphe est figé
+//! \pre les durées des chemins tiennent sur 32 bits
+//! \pre FileDial n'est pas utilisable avec p_moinsDeCorrespondances: une correspondance fait sauter la clé
+//! \pre de 2^32, et la file de Dial devrait allouer 2^32 + poidsMax seaux; elle convient pour la durée seule
+//! \param[in] p_attente le délai compris dans le poids de chaque arc
+//! \param[in] p_moinsDeCorrespondances vrai pour minimiser les correspondances, puis la durée; faux pour la durée seule
+//! \param[out] p_chemin le chemin; sa longueur est sa durée
+//! \param[in,out] p_contexte l'espace de travail de la recherche, dont les clés sont sur 64 bits
+//! \return la durée du chemin (= numeric_limits<N>::max() si aucun chemin)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraCorrespondances(const unsigned int & p_origine, const unsigned int & p_destination, N p_attente,
+		bool p_moinsDeCorrespondances, Chemin<T, N> & p_chemin,
+		ContexteRecherche<unsigned long long, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	PRECONDITION( !(p_moinsDeCorrespondances && std::is_same<FilePriorite, FileDial<unsigned long long> >::value));
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+
+	typedef unsigned long long cle;
+	const cle uneCorrespondance = p_moinsDeCorrespondances ? cle(1) << 32 : 0;
+	const cle dureeMasque = (cle(1) << 32) - 1;
+
+	p_contexte.preparer(m_nbSommets, uneCorrespondance + m_arcs.reqPoidsMax());
+	FilePriorite & lesSommetsARegarder = p_contexte.reqFile();
+	p_contexte.fixer(origine, 0, numeric_limits<unsigned int>::max());
+	lesSommetsARegarder.insererOuDiminuer(origine, 0);
+
+	while (!lesSommetsARegarder.estVide())
+	{
+		cle distance;
+		unsigned int sommet = lesSommetsARegarder.extraireMin(distance);
+		if (sommet == destination)
+			break;
+
+		for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = m_arcs.reqDestination(k);
+			N poids = m_arcs.reqPoids(k);
+			cle coutArc;
+			if (m_noms[unVoisin] == m_noms[sommet])
+				coutArc = uneCorrespondance + poids;
+			else if (sommet != origine && p_attente < poids)
+				coutArc = poids - p_attente;
+			else
+				coutArc = poids;
+			cle poidsTotalVoisin = distance + coutArc;
+			if (poidsTotalVoisin < p_contexte.reqDistance(unVoisin))
+			{
+				p_contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				lesSommetsARegarder.insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+		}
+	}
+
+	p_chemin.m_graphe = this;
+	construireChemin(destination, p_contexte, p_chemin.m_sommets);
+	versExterne(p_chemin.m_sommets);
+	p_chemin.m_longueur = p_contexte.estAtteint(destination)
+			? static_cast<N>(p_moinsDeCorrespondances ? p_contexte.reqDistance(destination) & dureeMasque : p_contexte.reqDistance(destination))
+			: numeric_limits<N>::max();
+	return p_chemin.m_longueur;
+}
+
+//! \brief Les p_k plus courts chemins sans boucle de p_origine à p_destination (algorithme de Yen)
+//! \pre p_origine et p_destination sont des sommets du graphe; le graphe est figé
+//! \param[out] p_chemins les chemins, par longueur croissante (moins de p_k s'il n'en existe pas autant)
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::kPlusCourtsChemins(const unsigned int & p_origine, const unsigned int & p_destination, unsigned int p_k,
+		std::vector< Chemin<T, N> > & p_chemins) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	kPlusCourtsChemins(p_origine, p_destination, p_k, p_chemins, contexte);
+}
+
+//! \brief Les p_k plus courts chemins sans boucle de p_origine à p_destination (algorithme de Yen)
+//! \brief Pour le dernier chemin retenu P et chaque sommet de déviation P[i], une recherche part de P[i] vers la
+//! \brief destination en évitant les sommets de la racine P[0..i-1] et, pour chaque chemin retenu qui partage
+//! \brief cette racine, l'arc qui la prolonge. Les masques sont des tableaux de marques par sommet et par arc:
+//! \brief le graphe n'est jamais copié et changer de masque ne coûte qu'un incrément de marque. La racine
+//! \brief (sa longueur, ses sommets masqués, les chemins retenus qui la partagent) est prolongée d'un sommet à
+//! \brief la fois. Les candidats sont rangés bout à bout dans un seul tableau de sommets.
+//! \pre p_origine et p_destination sont des sommets du graphe; le graphe est figé
+//! \param[out] p_chemins les chemins, par longueur croissante (moins de p_k s'il n'en existe pas autant)
+//! \param[in,out] p_contexte l'espace de travail de toutes les recherches, réutilisé d'un appel à l'autre
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::kPlusCourtsChemins(const unsigned int & p_origine, const unsigned int & p_destination, unsigned int p_k,
+		std::vector< Chemin<T, N> > & p_chemins,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+
+	p_chemins.clear();
+	if (p_k == 0)
+		return;
+	DijkstraCalculerChemins(origine, destination, p_contexte);
+	if (!p_contexte.estAtteint(destination))
+		return;
+	p_chemins.resize(1);
+	p_chemins[0].m_graphe = this;
+	p_chemins[0].m_longueur = p_contexte.reqDistance(destination);
+	construireChemin(destination, p_contexte, p_chemins[0].m_sommets);
+
+	std::vector<unsigned int> sommetsCandidats;                     /*!< les sommets des candidats, bout à bout */
+	std::vector< std::pair<unsigned int, unsigned int> > candidats; /*!< (début, taille) de chaque candidat */
+	std::set< std::pair<N, unsigned int> > enAttente;               /*!< (longueur, candidat) pas encore retenus */
+	std::vector<unsigned int> marqueSommets(m_nbSommets, 0);
+	std::vector<unsigned int> marqueArcs(m_arcs.reqNbArcs(), 0);
+	unsigned int marqueSommet = 0, marqueArc = 0;
+	std::vector<unsigned int> partageant, deviation;
+
+	while (p_chemins.size() < p_k)
+	{
+		const std::vector<unsigned int> & dernier = p_chemins.back().m_sommets;
+		++marqueSommet;
+		partageant.clear();
+		for (unsigned int j = 0; j < p_chemins.size(); ++j)
+			partageant.push_back(j);
+
+		N longueurRacine = 0;
+		for (unsigned int i = 0; i + 1 < dernier.size(); ++i)
+		{
+			const unsigned int sommetDeviation = dernier[i];
+			if (i > 0)
+			{
+				longueurRacine += m_arcs.reqPoids(m_arcs.trouverArc(dernier[i - 1], sommetDeviation));
+				marqueSommets[dernier[i - 1]] = marqueSommet;
+			}
+
+			//les chemins retenus qui partagent la racine dernier[0..i] perdent l'arc qui la prolonge
+			++marqueArc;
+			unsigned int nb = 0;
+			for (unsigned int j = 0; j < partageant.size(); ++j)
+			{
+				const std::vector<unsigned int> & retenu = p_chemins[partageant[j]].m_sommets;
+				if (retenu.size() <= i + 1 || retenu[i] != sommetDeviation)
+					continue;
+				marqueArcs[m_arcs.trouverArc(sommetDeviation, retenu[i + 1])] = marqueArc;
+				partageant[nb++] = partageant[j];
+			}
+			partageant.resize(nb);
+
+			dijkstraMasque(sommetDeviation, destination, marqueSommets, marqueSommet, marqueArcs, marqueArc, p_contexte);
+			if (!p_contexte.estAtteint(destination))
+				continue;
+			construireChemin(destination, p_contexte, deviation);
+			N longueur = longueurRacine + p_contexte.reqDistance(destination);
+
+			//un même candidat peut être trouvé depuis deux chemins retenus
+			unsigned int taille = i + deviation.size();
+			bool doublon = false;
+			for (typename std::set< std::pair<N, unsigned int> >::const_iterator itr = enAttente.lower_bound(std::make_pair(longueur, 0u));
+					!doublon && itr != enAttente.end() && !(longueur < itr->first); ++itr)
+			{
+				const std::pair<unsigned int, unsigned int> & autre = candidats[itr->second];
+				doublon = autre.second == taille
+						&& std::equal(dernier.begin(), dernier.begin() + i, sommetsCandidats.begin() + autre.first)
+						&& std::equal(deviation.begin(), deviation.end(), sommetsCandidats.begin() + autre.first + i);
+			}
+			if (doublon)
+				continue;
+			candidats.push_back(std::make_pair((unsigned int) sommetsCandidats.size(), taille));
+			sommetsCandidats.insert(sommetsCandidats.end(), dernier.begin(), dernier.begin() + i);
+			sommetsCandidats.insert(sommetsCandidats.end(), deviation.begin(), deviation.end());
+			enAttente.insert(std::make_pair(longueur, (unsigned int) candidats.size() - 1));
+		}
+
+		if (enAttente.empty())
+			break;
+		const std::pair<unsigned int, unsigned int> & meilleur = candidats[enAttente.begin()->second];
+		p_chemins.push_back(Chemin<T, N>());
+		Chemin<T, N> & chemin = p_chemins.back();
+		chemin.m_graphe = this;
+		chemin.m_longueur = enAttente.begin()->first;
+		chemin.m_sommets.assign(sommetsCandidats.begin() + meilleur.first, sommetsCandidats.begin() + meilleur.first + meilleur.second);
+		enAttente.erase(enAttente.begin());
+	}
+
+	for (unsigned int j = 0; j < p_chemins.size(); ++j)
+		versExterne(p_chemins[j].m_sommets);
+}
+
+//! \brief Front de Pareto des chemins selon (durée, correspondances)
+//! \pre p_origine et p_destination sont des sommets du graphe; le graphe est figé
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+void Graphe<T,N>::frontPareto(const unsigned int & p_origine, const unsigned int & p_destination, N p_attente,
+		std::vector< Chemin<T, N> > & p_front, unsigned int p_maxEtiquettes) const
+{
+	ContextePareto<N> contexte;
+	frontPareto(p_origine, p_destination, p_attente, p_front, p_maxEtiquettes, contexte);
+}
+
+//! \brief Front de Pareto des chemins selon (durée, correspondances)
+//! \brief recherche par étiquettes: les étiquettes sont traitées en ordre de (durée, correspondances), et une
+//! \brief étiquette extraite qui n'a pas été dominée entre-temps est définitive. Une étiquette est abandonnée si
+//! \brief le sac de son sommet ou celui de la destination en contient une au moins aussi bonne sur les deux critères.
+//! \brief Les durées suivent le modèle de dijkstraCorrespondances(): l'attente n'est comptée qu'à la montée
+//! \brief et aux correspondances (p_attente = 0 garde les poids tels quels).
+//! \pre p_origine et p_destination sont des sommets du graphe; le graphe est figé
+//! \param[in] p_attente le délai compris dans le poids de chaque arc
+//! \param[out] p_front les chemins du front, par durée croissante (vide si p_destination n'est pas atteignable)
+//! \param[in] p_maxEtiquettes le nombre maximal d'étiquettes gardées par sommet
+//! \note un sac plein ne garde que les étiquettes les plus rapides: le temps de réponse reste borné et le chemin le plus
+//! \note rapide est toujours trouvé, mais des chemins du front avec moins de correspondances peuvent manquer
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+template<typename T,typename N>
+void Graphe<T,N>::frontPareto(const unsigned int & p_origine, const unsigned int & p_destination, N p_attente,
+		std::vector< Chemin<T, N> > & p_front, unsigned int p_maxEtiquettes,
+		ContextePareto<N> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+	typedef typename ContextePareto<N>::etiquette etiquette;
+
+	p_contexte.preparer(m_nbSommets, p_maxEtiquettes);
+	p_contexte.ajouter(p_contexte.creer(0, 0, origine, ContextePareto<N>::AUCUNE));
+	while (!p_contexte.estVide())
+	{
+		unsigned int index = p_contexte.extraireMin();
+		const etiquette courante = p_contexte.reqEtiquette(index);
+		if (courante.dominee || courante.sommet == destination)
+			continue;
+
+		const unsigned int sommet = courante.sommet;
+		for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = m_arcs.reqDestination(k);
+			N poids = m_arcs.reqPoids(k);
+			unsigned int correspondances = courante.correspondances;
+			if (m_noms[unVoisin] == m_noms[sommet])
+				++correspondances;
+			else if (sommet != origine && p_attente < poids)
+				poids -= p_attente;
+			N duree = courante.duree + poids;
+			if (p_contexte.estDominee(unVoisin, duree, correspondances)
+					|| p_contexte.estDominee(destination, duree, correspondances))
+				continue;
+			p_contexte.ajouter(p_contexte.creer(duree, correspondances, unVoisin, index));
+		}
+	}
+
+	const unsigned int taille = p_contexte.reqTailleSac(destination);
+	std::vector< std::pair<N, unsigned int> > arrivees;
+	for (unsigned int i = 0; i < taille; ++i)
+	{
+		unsigned int index = p_contexte.reqDuSac(destination, i);
+		arrivees.push_back(std::make_pair(p_contexte.reqEtiquette(index).duree, index));
+	}
+	std::sort(arrivees.begin(), arrivees.end());
+
+	p_front.resize(taille);
+	for (unsigned int i = 0; i < taille; ++i)
+	{
+		Chemin<T, N> & chemin = p_front[i];
+		chemin.m_graphe = this;
+		chemin.m_longueur = arrivees[i].first;
+		chemin.m_sommets.clear();
+		for (unsigned int index = arrivees[i].second; index != ContextePareto<N>::AUCUNE; index = p_contexte.reqEtiquette(index).parent)
+			chemin.m_sommets.push_back(p_contexte.reqEtiquette(index).sommet);
+		std::reverse(chemin.m_sommets.begin(), chemin.m_sommets.end());
+		versExterne(chemin.m_sommets);
+	}
+}
+
+//! \brief Trajet le plus rapide pour un départ à l'instant p_depart, avec des durées d'arcs qui dépendent de l'heure
+//! \pre p_profils a été construit avec construire(reqArcs(), ..., reqVersion()) depuis le dernier changement des arcs
+//! \param[out] p_chemin le chemin; sa longueur est la durée du trajet (arrivée - départ)
+//! \return l'instant d'arrivée (= numeric_limits<N>::max() si aucun chemin)
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraHoraire(const unsigned int & p_origine, const unsigned int & p_destination, N p_depart,
+		const ProfilsTemps<N> & p_profils, Chemin<T, N> & p_chemin) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	return dijkstraHoraire(p_origine, p_destination, p_depart, p_profils, p_chemin, contexte);
+}
+
+//! \brief Trajet le plus rapide pour un départ à l'instant p_depart, avec des durées d'arcs qui dépendent de l'heure
+//! \brief l'algorithme de Dijkstra où l'étiquette d'un sommet est son instant d'arrivée; un arc k quitté
+//! \brief à l'instant t mène au voisin à t + p_profils.evaluer(k, t). Comme les profils sont FIFO,
+//! \brief arriver plus tôt à un sommet n'est jamais pire et la première extraction d'un sommet est définitive.
+//! \pre p_profils a été construit avec construire(reqArcs(), ..., reqVersion()) depuis le dernier changement des arcs
+//! \param[out] p_chemin le chemin; sa longueur est la durée du trajet (arrivée - départ)
+//! \param[in,out] p_contexte l'espace de travail de la recherche; ses distances sont des instants d'arrivée
+//! \return l'instant d'arrivée (= numeric_limits<N>::max() si aucun chemin)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraHoraire(const unsigned int & p_origine, const unsigned int & p_destination, N p_depart,
+		const ProfilsTemps<N> & p_profils, Chemin<T, N> & p_chemin,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	PRECONDITION( p_profils.reqNbArcs() == m_arcs.reqNbArcs() && p_profils.reqVersion() == m_version);
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+
+	//les clés extraites croissent et une clé insérée dépasse au plus de reqDureeMax() la dernière extraite
+	p_contexte.preparer(m_nbSommets, p_profils.reqDureeMax());
+	FilePriorite & lesSommetsARegarder = p_contexte.reqFile();
+	p_contexte.fixer(origine, p_depart, numeric_limits<unsigned int>::max());
+	lesSommetsARegarder.insererOuDiminuer(origine, p_depart);
+
+	while (!lesSommetsARegarder.estVide())
+	{
+		N instant;
+		unsigned int sommet = lesSommetsARegarder.extraireMin(instant);
+		if (sommet == destination)
+			break;
+
+		for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = m_arcs.reqDestination(k);
+			N arrivee = instant + p_profils.evaluer(k, instant);
+			if (arrivee < p_contexte.reqDistance(unVoisin))
+			{
+				p_contexte.fixer(unVoisin, arrivee, sommet);
+				lesSommetsARegarder.insererOuDiminuer(unVoisin, arrivee);
+			}
+		}
+	}
+
+	p_chemin.m_graphe = this;
+	construireChemin(destination, p_contexte, p_chemin.m_sommets);
+	versExterne(p_chemin.m_sommets);
+	if (!p_contexte.estAtteint(destination))
+	{
+		p_chemin.m_longueur = numeric_limits<N>::max();
+		return numeric_limits<N>::max();
+	}
+	p_chemin.m_longueur = p_contexte.reqDistance(destination) - p_depart;
+	return p_contexte.reqDistance(destination);
+}
+
+//! \brief Prétraitement ALT: choisit p_nbReperes repères par sélection du point le plus éloigné
+//! \brief et calcule les distances de chaque sommet vers et depuis chacun d'eux
+//! \brief le premier repère est le sommet le plus éloigné du sommet 0; chaque repère suivant est le
+//! \brief sommet qui maximise sa distance (aller + retour) au repère le plus proche déjà choisi
+//! \param[in] p_nbReperes le nombre de repères (au plus le nombre de sommets)
+//! \param[out] p_table la table des repères
+//! \pre le graphe doit être figé et les distances doivent tenir sur 32 bits
+template<typename T,typename N>
+void Graphe<T,N>::calculerReperes(unsigned int p_nbReperes, TableReperes & p_table) const
+{
+	PRECONDITION( estFige());
+	PRECONDITION( p_nbReperes <= m_nbSommets);
+	p_table.redimensionner(m_nbSommets, p_nbReperes);
+	p_table.fixerVersion(m_version);
+	p_table.fixerEmpreinte(m_arcs.calculerEmpreinte());
+	if (p_nbReperes == 0)
+		return;
+
+	//distance aller-retour au repère le plus proche, sur 64 bits (infini = max)
+	const unsigned long long INFINI = numeric_limits<unsigned long long>::max();
+	std::vector<unsigned long long> eloignement(m_nbSommets, INFINI);
+	std::vector<bool> estRepere(m_nbSommets, false);
+	ContexteRecherche<N> avant;
+	ContexteRecherche<N> arriere;
+
+	unsigned int candidat = 0;
+	for (unsigned int l = 0; l <= p_nbReperes; ++l)
+	{
+		DijkstraCalculerChemins(candidat, numeric_limits<unsigned int>::max(), m_arcs, avant);
+		DijkstraCalculerChemins(candidat, numeric_limits<unsigned int>::max(), m_arcsInverses, arriere);
+
+		if (l > 0)
+		{
+			//candidat est le repère l-1
+			p_table.fixerRepere(l - 1, candidat);
+			estRepere[candidat] = true;
+			for (unsigned int v = 0; v < m_nbSommets; ++v)
+			{
+				N depuis = avant.reqDistance(v);
+				N vers = arriere.reqDistance(v);
+				PRECONDITION( depuis == numeric_limits<N>::max() || depuis < TableReperes::INFINI);
+				PRECONDITION( vers == numeric_limits<N>::max() || vers < TableReperes::INFINI);
+				p_table.fixerDistances(l - 1, v,
+						depuis == numeric_limits<N>::max() ? TableReperes::INFINI : static_cast<uint32_t>(depuis),
+						vers == numeric_limits<N>::max() ? TableReperes::INFINI : static_cast<uint32_t>(vers));
+			}
+		}
+		if (l == p_nbReperes)
+			break;
+
+		//le prochain repère est le sommet le plus éloigné des repères déjà choisis (ou du sommet 0)
+		unsigned long long meilleur = 0;
+		for (unsigned int v = 0; v < m_nbSommets; ++v)
+		{
+			N depuis = avant.reqDistance(v);
+			N vers = arriere.reqDistance(v);
+			unsigned long long allerRetour = (depuis == numeric_limits<N>::max() || vers == numeric_limits<N>::max())
+					? INFINI - 1 : static_cast<unsigned long long>(depuis) + static_cast<unsigned long long>(vers);
+			if (l > 0 && allerRetour < eloignement[v])
+				eloignement[v] = allerRetour;
+			unsigned long long score = l > 0 ? eloignement[v] : allerRetour;
+			if (!estRepere[v] && (score > meilleur || (meilleur == 0 && v != candidat)))
+			{
+				meilleur = score;
+				candidat = v;
+			}
+		}
+	}
+}
+
+//! \brief Recherche A* guidée par les bornes inférieures des repères (ALT)
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] le chemin est retourné
+//! \param[in] p_reperes la table produite par calculerReperes() (ou chargée d'un fichier) pour ce graphe, depuis le dernier changement des arcs
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraALT(const unsigned int & p_origine, const unsigned int & p_destination,
+		std::vector< std::pair<unsigned int, T> > & p_chemin,
+		const TableReperes & p_reperes) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	return dijkstraALT(p_origine, p_destination, p_chemin, p_reperes, contexte);
+}
+
+//! \brief Recherche A* guidée par les bornes inférieures des repères (ALT)
+//! \brief la clé d'un sommet v dans la file est d(origine,v) + h(v), où h(v) est la borne inférieure
+//! \brief de d(v,destination) donnée par l'inégalité du triangle. Ces bornes sont cohérentes: chaque
+//! \brief sommet est solutionné une seule fois et la recherche s'arrête quand p_destination l'est.
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] le chemin est retourné
+//! \param[in] p_reperes la table produite par calculerReperes() (ou chargée d'un fichier) pour ce graphe, depuis le dernier changement des arcs
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note les clés ne sont pas bornées par la dernière clé + poidsMax: FileDial ne convient pas
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraALT(const unsigned int & p_origine, const unsigned int & p_destination,
+		std::vector< std::pair<unsigned int, T> > & p_chemin,
+		const TableReperes & p_reperes,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	Chemin<T, N> chemin;
+	dijkstraALT(p_origine, p_destination, chemin, p_reperes, p_contexte);
+	chemin.exporter(p_chemin);
+	return chemin.reqLongueur();
+}
+
+//! \brief Recherche A* guidée par les bornes inférieures des repères (ALT)
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] p_chemin les sommets du chemin et sa longueur; les noms ne sont pas copiés
+//! \param[in] p_reperes la table produite par calculerReperes() (ou chargée d'un fichier) pour ce graphe, depuis le dernier changement des arcs
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraALT(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin,
+		const TableReperes & p_reperes) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	return dijkstraALT(p_origine, p_destination, p_chemin, p_reperes, contexte);
+}
+
+//! \brief Recherche A* guidée par les bornes inférieures des repères (ALT)
+//! \brief voir la surcharge avec std::vector pour la description de l'algorithme
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] p_chemin les sommets du chemin et sa longueur; les noms ne sont pas copiés
+//! \param[in] p_reperes la table produite par calculerReperes() (ou chargée d'un fichier) pour ce graphe, depuis le dernier changement des arcs
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraALT(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin,
+		const TableReperes & p_reperes,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	PRECONDITION( p_reperes.reqNbSommets() == m_nbSommets && p_reperes.reqVersion() == m_version);
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+
+	p_contexte.preparer(m_nbSommets, m_arcs.reqPoidsMax());
+	p_contexte.fixer(origine, 0, numeric_limits<unsigned int>::max());
+	FilePriorite & lesSommetsARegarder = p_contexte.reqFile();
+	lesSommetsARegarder.insererOuDiminuer(origine, static_cast<N>(p_reperes.borneInferieure(origine, destination)));
+
+	while (!lesSommetsARegarder.estVide())
+	{
+		N cle;
+		unsigned int sommet = lesSommetsARegarder.extraireMin(cle);
+		if (sommet == destination)
+			break;
+
+		N distance = p_contexte.reqDistance(sommet);
+		for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = m_arcs.reqDestination(k);
+			N poidsTotalVoisin = distance + m_arcs.reqPoids(k);
+			if (poidsTotalVoisin < p_contexte.reqDistance(unVoisin))
+			{
+				p_contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				lesSommetsARegarder.insererOuDiminuer(unVoisin,
+						poidsTotalVoisin + static_cast<N>(p_reperes.borneInferieure(unVoisin, destination)));
+			}
+		}
+	}
+
+	p_chemin.m_graphe = this;
+	construireChemin(destination, p_contexte, p_chemin.m_sommets);
+	versExterne(p_chemin.m_sommets);
+	p_chemin.m_longueur = p_contexte.estAtteint(destination) ? p_contexte.reqDistance(destination) : numeric_limits<N>::max();
+	return p_chemin.m_longueur;
+}
+
+//! \brief Prétraitement par hiérarchie de contraction
+//! \param[out] p_hierarchie la hiérarchie construite à partir des arcs du graphe
+//! \pre le graphe doit être figé
+template<typename T,typename N>
+void Graphe<T,N>::construireHierarchie(HierarchieContraction<N> & p_hierarchie) const
+{
+	PRECONDITION( estFige());
+	p_hierarchie.construire(m_arcs, m_version);
+}
+
+//! \brief Plus court chemin entre p_origine et p_destination à l'aide d'une hiérarchie de contraction
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] le chemin est retourné, raccourcis dépliés
+//! \param[in] p_hierarchie la hiérarchie construite par construireHierarchie() pour ce graphe, depuis le dernier changement des arcs
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note deux contextes de recherche temporaires sont alloués: utiliser la surcharge avec contextes pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraCH(const unsigned int & p_origine, const unsigned int & p_destination,
+		std::vector< std::pair<unsigned int, T> > & p_chemin,
+		const HierarchieContraction<N> & p_hierarchie) const
+{
+	ContexteRecherche<N, FilePriorite> contexteAvant;
+	ContexteRecherche<N, FilePriorite> contexteArriere;
+	return dijkstraCH(p_origine, p_destination, p_chemin, p_hierarchie, contexteAvant, contexteArriere);
+}
+
+//! \brief Plus court chemin entre p_origine et p_destination à l'aide d'une hiérarchie de contraction
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] le chemin est retourné, raccourcis dépliés
+//! \param[in] p_hierarchie la hiérarchie construite par construireHierarchie() pour ce graphe, depuis le dernier changement des arcs
+//! \param[in,out] p_contexteAvant l'espace de travail de la recherche avant
+//! \param[in,out] p_contexteArriere l'espace de travail de la recherche arrière
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note la longueur est toujours celle de dijkstraV2; entre plusieurs plus courts chemins de même
+//! \note longueur, le chemin retourné peut différer
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraCH(const unsigned int & p_origine, const unsigned int & p_destination,
+		std::vector< std::pair<unsigned int, T> > & p_chemin,
+		const HierarchieContraction<N> & p_hierarchie,
+		ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+		ContexteRecherche<N, FilePriorite> & p_contexteArriere) const
+{
+	Chemin<T, N> chemin;
+	dijkstraCH(p_origine, p_destination, chemin, p_hierarchie, p_contexteAvant, p_contexteArriere);
+	chemin.exporter(p_chemin);
+	return chemin.reqLongueur();
+}
+
+//! \brief Plus court chemin entre p_origine et p_destination à l'aide d'une hiérarchie de contraction
+//! \pre p_origine et p_destination doivent être des sommets du graphe
+//! \param[out] p_chemin les sommets du chemin, raccourcis dépliés, et sa longueur; les noms ne sont pas copiés
+//! \param[in] p_hierarchie la hiérarchie construite par construireHierarchie() pour ce graphe, depuis le dernier changement des arcs
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+//! \note deux contextes de recherche temporaires sont alloués: utiliser la surcharge avec contextes pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraCH(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin,
+		const HierarchieContraction<N> & p_hierarchie) const
+{
+	ContexteRecherche<N, FilePriorite> contexteAvant;
+	ContexteRecherche<N, FilePriorite> contexteArriere;
+	return dijkstraCH(p_origine, p_destination, p_chemin, p_hierarchie, contexteAvant, contexteArriere);
+}
+
+//! \brief Plus court chemin entre p_origine et p_destination à l'aide d'une hiérarchie de contraction
+//! \pre p_origine et p_destination doivent être des sommets du graphe; le graphe doit être figé
+//! \param[out] p_chemin les sommets du chemin, raccourcis dépliés, et sa longueur; les noms ne sont pas copiés
+//! \param[in] p_hierarchie la hiérarchie construite par construireHierarchie() pour ce graphe, depuis le dernier changement des arcs
+//! \param[in,out] p_contexteAvant l'espace de travail de la recherche avant
+//! \param[in,out] p_contexteArriere l'espace de travail de la recherche arrière
+//! \return la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable)
+template<typename T,typename N>
+template<typename FilePriorite>
+N Graphe<T,N>::dijkstraCH(const unsigned int & p_origine, const unsigned int & p_destination,
+		Chemin<T, N> & p_chemin,
+		const HierarchieContraction<N> & p_hierarchie,
+		ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+		ContexteRecherche<N, FilePriorite> & p_contexteArriere) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION( estFige());
+	PRECONDITION( p_hierarchie.reqNbSommets() == m_nbSommets && p_hierarchie.reqVersion() == m_version);
+	const unsigned int origine = interne(p_origine), destination = interne(p_destination);
+
+	p_chemin.m_graphe = this;
+	p_chemin.m_longueur = p_hierarchie.requete(origine, destination, p_chemin.m_sommets, p_contexteAvant, p_contexteArriere);
+	versExterne(p_chemin.m_sommets);
+	return p_chemin.m_longueur;
+}
+
+//! \brief Distances d'une origine vers plusieurs destinations
+//! \pre p_origine et les destinations doivent être des sommets du graphe
+//! \param[out] p_distances au moins |destinations| cases: la distance vers chaque destination, dans l'ordre
+//! \note un contexte de recherche temporaire est alloué: utiliser la surcharge avec contexte pour des requêtes répétées
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::unAPlusieurs(unsigned int p_origine, const std::vector<unsigned int> & p_destinations, N * p_distances) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	unAPlusieurs(p_origine, p_destinations, p_distances, contexte);
+}
+
+//! \brief Distances d'une origine vers plusieurs destinations
+//! \brief une seule recherche de Dijkstra, arrêtée dès que toutes les destinations sont solutionnées
+//! \pre p_origine et les destinations doivent être des sommets du graphe
+//! \param[out] p_distances au moins |destinations| cases: la distance vers chaque destination, dans l'ordre
+//! \param[out] (= numeric_limits<N>::max() pour une destination non atteignable)
+//! \param[in,out] p_contexte l'espace de travail de la recherche, réutilisé d'un appel à l'autre
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::unAPlusieurs(unsigned int p_origine, const std::vector<unsigned int> & p_destinations, N * p_distances,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	std::vector<unsigned int> internes, destinationsTriees;
+	const std::vector<unsigned int> & destinations = versInterne(p_destinations, internes);
+	trierSansDoublons(destinations, destinationsTriees);
+	unAPlusieurs(interne(p_origine), destinationsTriees, destinations, p_distances, p_contexte);
+}
+
+//! \brief Matrice des distances de plusieurs origines vers plusieurs destinations
+//! \brief utilise un bassin de fils temporaire d'un fil par coeur
+//! \param[out] p_matrice au moins |origines| x |destinations| cases, par rangée
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::matriceDistances(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+		N * p_matrice) const
+{
+	BassinFils bassin;
+	matriceDistances<FilePriorite>(p_origines, p_destinations, p_matrice, bassin);
+}
+
+//! \brief Matrice des distances de plusieurs origines vers plusieurs destinations
+//! \brief une recherche par origine, arrêtée dès que toutes les destinations sont solutionnées;
+//! \brief les origines se partagent entre les fils du bassin, chacun avec son contexte de recherche
+//! \pre le graphe doit être figé; les origines et les destinations doivent être des sommets du graphe
+//! \param[out] p_matrice au moins |origines| x |destinations| cases, par rangée: la case (i, j) est à
+//! \param[out] l'index i * |destinations| + j (= numeric_limits<N>::max() si non atteignable)
+//! \param[in] p_bassin le bassin de fils d'exécution qui se partage les origines
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::matriceDistances(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+		N * p_matrice, BassinFils & p_bassin) const
+{
+	PRECONDITION( estFige());
+	std::vector<unsigned int> internes, destinationsTriees;
+	const std::vector<unsigned int> & destinations = versInterne(p_destinations, internes);
+	trierSansDoublons(destinations, destinationsTriees);
+
+	std::vector< ContexteRecherche<N, FilePriorite> > contextes(p_bassin.reqNbFils());
+	p_bassin.executer(p_origines.size(), [&](unsigned int p_origine, unsigned int p_fil)
+	{
+		unAPlusieurs(interne(p_origines[p_origine]), destinationsTriees, destinations,
+				p_matrice + p_origine * destinations.size(), contextes[p_fil]);
+	});
+}
+
+//! \brief Matrice des distances de plusieurs origines vers plusieurs destinations, par seaux
+//! \brief (voir HierarchieContraction::matriceDistances): |origines| + |destinations| recherches
+//! \brief montantes au lieu de |origines| recherches complètes
+//! \param[out] p_matrice au moins |origines| x |destinations| cases, par rangée
+//! \param[in] p_hierarchie la hiérarchie construite par construireHierarchie() pour ce graphe, depuis le dernier changement des arcs
+//! \param[in] p_bassin le bassin de fils d'exécution
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::matriceDistances(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+		N * p_matrice, const HierarchieContraction<N> & p_hierarchie, BassinFils & p_bassin) const
+{
+	PRECONDITION( estFige());
+	PRECONDITION( p_hierarchie.reqNbSommets() == m_nbSommets && p_hierarchie.reqVersion() == m_version);
+	std::vector<unsigned int> origines, destinations;
+	p_hierarchie.template matriceDistances<FilePriorite>(versInterne(p_origines, origines), versInterne(p_destinations, destinations),
+			p_matrice, p_bassin);
+}
+
+//! \brief Calcule les plus courtes distances entre toutes les paires de sommets, en parallèle
+//! \brief utilise un bassin de fils temporaire d'un fil par coeur
+//! \param[out] p_table la table n x n des distances (et des prédécesseurs si demandé)
+//! \param[in] p_avecPredecesseurs vrai pour remplir aussi la table des prédécesseurs
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::toutesLesPaires(TableDistances<N> & p_table, bool p_avecPredecesseurs) const
+{
+	BassinFils bassin;
+	toutesLesPaires<FilePriorite>(p_table, p_avecPredecesseurs, bassin);
+}
+
+//! \brief Calcule les plus courtes distances entre toutes les paires de sommets, en parallèle
+//! \brief une recherche complète par origine; chaque fil du bassin a son propre contexte de recherche
+//! \param[out] p_table la table n x n des distances (et des prédécesseurs si demandé)
+//! \param[in] p_avecPredecesseurs vrai pour remplir aussi la table des prédécesseurs
+//! \param[in] p_bassin le bassin de fils d'exécution qui se partage les origines
+//! \pre le graphe doit être figé
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::toutesLesPaires(TableDistances<N> & p_table, bool p_avecPredecesseurs, BassinFils & p_bassin) const
+{
+	PRECONDITION( estFige());
+	p_table.redimensionner(m_nbSommets, p_avecPredecesseurs);
+
+	std::vector< ContexteRecherche<N, FilePriorite> > contextes(p_bassin.reqNbFils());
+	p_bassin.executer(m_nbSommets, [&](unsigned int p_origine, unsigned int p_fil)
+	{
+		ContexteRecherche<N, FilePriorite> & contexte = contextes[p_fil];
+		DijkstraCalculerChemins(p_origine, numeric_limits<unsigned int>::max(), contexte);
+
+		N * distances = p_table.reqRangeeDistances(p_origine);
+		unsigned int * predecesseurs = p_table.reqRangeePredecesseurs(p_origine);
+		for (unsigned int i = 0; i < m_nbSommets; ++i)
+			distances[i] = contexte.reqDistance(i);
+		if (predecesseurs != 0)
+			for (unsigned int i = 0; i < m_nbSommets; ++i)
+				predecesseurs[i] = contexte.reqPredecesseur(i);
+	});
+	tableVersExterne(p_table);
+}
+
+//! \brief Calcule les plus courtes distances entre toutes les paires de sommets par Floyd-Warshall
+//! \brief utilise un bassin de fils temporaire d'un fil par coeur
+//! \param[out] p_table la table n x n des distances (et des prédécesseurs si demandé)
+//! \param[in] p_avecPredecesseurs vrai pour remplir aussi la table des prédécesseurs
+template<typename T,typename N>
+void Graphe<T,N>::floydWarshall(TableDistances<N> & p_table, bool p_avecPredecesseurs) const
+{
+	BassinFils bassin;
+	floydWarshall(p_table, p_avecPredecesseurs, bassin);
+}
+
+//! \brief Calcule les plus courtes distances entre toutes les paires de sommets par Floyd-Warshall
+//! \brief par tuiles sur une copie de la matrice d'adjacence (voir floydWarshallTuiles()); en O(n^3) mais
+//! \brief sans file de priorité, plus rapide que toutesLesPaires() sur un graphe petit ou dense
+//! \brief la table des prédécesseurs a le format de celle de toutesLesPaires() (reconstruireChemin() s'applique) et
+//! \brief décrit des plus courts chemins, mais peut en différer entre chemins de même longueur
+//! \param[out] p_table la table n x n des distances (et des prédécesseurs si demandé)
+//! \param[in] p_avecPredecesseurs vrai pour remplir aussi la table des prédécesseurs
+//! \param[in] p_bassin le bassin de fils d'exécution qui se partage les tuiles
+//! \pre le graphe doit être figé
+template<typename T,typename N>
+void Graphe<T,N>::floydWarshall(TableDistances<N> & p_table, bool p_avecPredecesseurs, BassinFils & p_bassin) const
+{
+	PRECONDITION( estFige());
+	p_table.redimensionner(m_nbSommets, p_avecPredecesseurs);
+	if (m_nbSommets == 0)
+		return;
+
+	construireMatrice();
+	N * distances = p_table.reqRangeeDistances(0);
+	std::copy(m_matrice.begin(), m_matrice.end(), distances);
+	bool poidsNul = false;
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+	{
+		distances[i * m_nbSommets + i] = 0;
+		for (unsigned int k = m_arcs.reqDebut(i); k < m_arcs.reqFin(i); ++k)
+			poidsNul = poidsNul || (m_arcs.reqPoids(k) == 0 && m_arcs.reqDestination(k) != i);
+	}
+
+	unsigned int * predecesseurs = p_table.reqRangeePredecesseurs(0);
+	if (predecesseurs != 0)
+		for (unsigned int i = 0; i < m_nbSommets; ++i)
+			for (unsigned int j = 0; j < m_nbSommets; ++j)
+				if (i != j && distances[i * m_nbSommets + j] != numeric_limits<N>::max())
+					predecesseurs[i * m_nbSommets + j] = i;
+
+	floydWarshallTuiles(distances, predecesseurs, m_nbSommets, p_bassin);
+	if (predecesseurs == 0 || !poidsNul)
+	{
+		tableVersExterne(p_table);
+		return;
+	}
+
+	//avec des cycles de poids nul, l'ordre des pivots par tuiles peut laisser des cycles de prédécesseurs
+	//(les distances restent exactes): chaque rangée est refaite par un parcours en largeur des arcs serrés
+	std::vector< std::vector<unsigned int> > files(p_bassin.reqNbFils());
+	p_bassin.executer(m_nbSommets, [&](unsigned int p_origine, unsigned int p_fil)
+	{
+		arbreArcsSerres(p_origine, distances + (size_t) p_origine * m_nbSommets,
+				predecesseurs + (size_t) p_origine * m_nbSommets, files[p_fil]);
+	});
+	tableVersExterne(p_table);
+}
+
+//! \brief Refait les prédécesseurs depuis p_origine par un parcours en largeur des arcs serrés
+//! \brief (arcs u -> v tels que d(u) + poids = d(v)); chaque sommet prend le premier qui l'atteint,
+//! \brief ce qui donne un arbre même avec des cycles de poids nul
+//! \param[in] p_distances les distances exactes depuis p_origine (n valeurs, numéros internes)
+//! \param[out] p_predecesseurs les n prédécesseurs
+//! \param[in,out] p_file espace de travail
+template<typename T,typename N>
+void Graphe<T,N>::arbreArcsSerres(unsigned int p_origine, const N * p_distances, unsigned int * p_predecesseurs,
+		std::vector<unsigned int> & p_file) const
+{
+	std::fill(p_predecesseurs, p_predecesseurs + m_nbSommets, numeric_limits<unsigned int>::max());
+	p_file.assign(1, p_origine);
+	for (size_t t = 0; t < p_file.size(); ++t)
+	{
+		unsigned int sommet = p_file[t];
+		for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = m_arcs.reqDestination(k);
+			if (unVoisin == p_origine || p_predecesseurs[unVoisin] != numeric_limits<unsigned int>::max())
+				continue;
+			if (m_arcs.reqPoids(k) <= p_distances[unVoisin] && p_distances[sommet] == p_distances[unVoisin] - m_arcs.reqPoids(k))
+			{
+				p_predecesseurs[unVoisin] = sommet;
+				p_file.push_back(unVoisin);
+			}
+		}
+	}
+}
+
+//! \brief Plus courtes distances de p_origine vers tous les sommets par delta-stepping, en parallèle
+//! \brief utilise un bassin de fils temporaire d'un fil par coeur
+template<typename T,typename N>
+void Graphe<T,N>::deltaStepping(const unsigned int & p_origine, std::vector<N> & p_distances,
+		std::vector<unsigned int> & p_predecesseurs, N p_largeur) const
+{
+	BassinFils bassin;
+	deltaStepping(p_origine, p_distances, p_predecesseurs, p_largeur, bassin);
+}
+
+//! \brief Remplace p_valeur par p_nouvelle si p_nouvelle est plus petite, de façon atomique
+//! \return vrai si p_valeur a été diminuée
+template<typename T,typename N>
+inline bool Graphe<T,N>::diminuerAtomique(N & p_valeur, N p_nouvelle)
+{
+	N actuelle;
+	__atomic_load(&p_valeur, &actuelle, __ATOMIC_RELAXED);
+	while (p_nouvelle < actuelle)
+		if (__atomic_compare_exchange(&p_valeur, &actuelle, &p_nouvelle, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			return true;
+	return false;
+}
+
+//! \brief Plus courtes distances de p_origine vers tous les sommets par delta-stepping (Meyer et Sanders)
+//! \brief les distances provisoires sont rangées dans des seaux de largeur p_largeur. Le seau courant est vidé
+//! \brief par vagues: les sommets de la vague relâchent en parallèle leurs arcs légers (poids <= p_largeur),
+//! \brief qui peuvent remettre des sommets dans le même seau; une fois le seau vide, les sommets qui y sont
+//! \brief passés relâchent leurs arcs lourds. Les distances sont diminuées par comparaison-échange atomique
+//! \brief et chaque fil note dans son propre tampon les sommets qu'il a améliorés, rangés ensuite dans les seaux.
+//! \brief les prédécesseurs sont choisis après coup, indépendamment de l'ordre des fils: parmi les arcs serrés
+//! \brief entrants, l'origine de plus petite (distance, numéro interne), comme le premier sommet solutionné par
+//! \brief Dijkstra avec TasDAire (parcours en largeur des arcs serrés s'il y a des arcs de poids nul)
+//! \param[out] p_distances la distance de p_origine à chaque sommet (numeric_limits<N>::max() si non atteint)
+//! \param[out] p_predecesseurs le prédécesseur de chaque sommet (numeric_limits<unsigned int>::max() si aucun)
+//! \param[in] p_largeur la largeur des seaux; 0 pour poids maximal / degré moyen
+//! \param[in] p_bassin le bassin de fils d'exécution qui se partage les vagues
+//! \pre le graphe doit être figé
+//! \note les distances et, sans arc de poids nul, les prédécesseurs sont ceux de Dijkstra avec TasDAire
+template<typename T,typename N>
+void Graphe<T,N>::deltaStepping(const unsigned int & p_origine, std::vector<N> & p_distances,
+		std::vector<unsigned int> & p_predecesseurs, N p_largeur, BassinFils & p_bassin) const
+{
+	PRECONDITION( p_origine < m_nbSommets);
+	PRECONDITION( estFige());
+	const unsigned int AUCUN = numeric_limits<unsigned int>::max();
+	const N INFINI = numeric_limits<N>::max();
+	const unsigned int TAILLE_LOT = 256; //sommets par tâche
+	const unsigned int origine = interne(p_origine);
+
+	if (p_largeur == 0)
+		p_largeur = std::max<N>(1, m_arcs.reqPoidsMax() / std::max<size_t>(1, m_arcs.reqNbArcs() / m_nbSommets));
+	//une distance provisoire ne dépasse jamais de plus de poidsMax + p_largeur le début du seau courant
+	const size_t nbSeaux = static_cast<size_t>(m_arcs.reqPoidsMax() / p_largeur) + 2;
+
+	std::vector<N> distances(m_nbSommets, INFINI);
+	std::vector<N> expansees(m_nbSommets, INFINI);                  //distance à laquelle le sommet a relâché ses arcs légers
+	std::vector<size_t> derniersSeaux(m_nbSommets, numeric_limits<size_t>::max());
+	std::vector< std::vector<unsigned int> > seaux(nbSeaux);
+	std::vector< std::vector<unsigned int> > ameliores(p_bassin.reqNbFils()); //tampon de chaque fil
+	std::vector<unsigned int> vague, passes;
+	size_t nbEntrees = 1;
+	distances[origine] = 0;
+	seaux[0].push_back(origine);
+
+	//relâche en parallèle les arcs légers ou lourds de p_sommets, puis range les sommets améliorés
+	auto relacher = [&](const std::vector<unsigned int> & p_sommets, bool p_legers)
+	{
+		auto tache = [&](unsigned int p_tache, unsigned int p_fil)
+		{
+			std::vector<unsigned int> & tampon = ameliores[p_fil];
+			for (size_t t = (size_t) p_tache * TAILLE_LOT, fin = std::min(p_sommets.size(), t + TAILLE_LOT); t < fin; ++t)
+			{
+				const unsigned int sommet = p_sommets[t];
+				N distance;
+				__atomic_load(&distances[sommet], &distance, __ATOMIC_RELAXED);
+				for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+				{
+					const N poids = m_arcs.reqPoids(k);
+					if ((poids <= p_largeur) == p_legers && diminuerAtomique(distances[m_arcs.reqDestination(k)], distance + poids))
+						tampon.push_back(m_arcs.reqDestination(k));
+				}
+			}
+		};
+		const unsigned int nbTaches = (p_sommets.size() + TAILLE_LOT - 1) / TAILLE_LOT;
+		if (nbTaches == 1)
+			tache(0, 0);
+		else if (nbTaches > 1)
+			p_bassin.executer(nbTaches, tache);
+
+		for (unsigned int f = 0; f < ameliores.size(); ++f)
+		{
+			for (unsigned int i = 0; i < ameliores[f].size(); ++i)
+				seaux[static_cast<size_t>(distances[ameliores[f][i]] / p_largeur) % nbSeaux].push_back(ameliores[f][i]);
+			nbEntrees += ameliores[f].size();
+			ameliores[f].clear();
+		}
+	};
+
+	for (size_t courant = 0; nbEntrees > 0; ++courant)
+	{
+		std::vector<unsigned int> & seau = seaux[courant % nbSeaux];
+		passes.clear();
+		while (!seau.empty())
+		{
+			//une entrée est périmée si sa distance a diminué depuis (vers un autre seau ou déjà relâchée)
+			nbEntrees -= seau.size();
+			vague.clear();
+			for (unsigned int i = 0; i < seau.size(); ++i)
+			{
+				const unsigned int sommet = seau[i];
+				if (static_cast<size_t>(distances[sommet] / p_largeur) != courant || expansees[sommet] == distances[sommet])
+					continue;
+				expansees[sommet] = distances[sommet];
+				vague.push_back(sommet);
+				if (derniersSeaux[sommet] != courant)
+				{
+					derniersSeaux[sommet] = courant;
+					passes.push_back(sommet);
+				}
+			}
+			seau.clear();
+			relacher(vague, true);
+		}
+		relacher(passes, false);
+	}
+
+	//prédécesseurs: parmi les sommets u tels que d(u) + poids(u, v) = d(v), celui de plus petit (d(u), u),
+	//c'est-à-dire le premier que Dijkstra solutionne avec un tas qui départage les égalités par numéro
+	std::vector<unsigned int> predecesseurs(m_nbSommets, AUCUN);
+	std::vector<char> poidsNul(p_bassin.reqNbFils(), 0);
+	p_bassin.executer((m_nbSommets + TAILLE_LOT - 1) / TAILLE_LOT, [&](unsigned int p_tache, unsigned int p_fil)
+	{
+		for (unsigned int v = p_tache * TAILLE_LOT, fin = std::min<size_t>(m_nbSommets, v + TAILLE_LOT); v < fin; ++v)
+		{
+			if (v == origine || distances[v] == INFINI)
+				continue;
+			for (unsigned int k = m_arcsInverses.reqDebut(v), fin = m_arcsInverses.reqFin(v); k < fin; ++k)
+			{
+				const unsigned int u = m_arcsInverses.reqDestination(k);
+				const N poids = m_arcsInverses.reqPoids(k);
+				if (u == v || distances[u] == INFINI || poids > distances[v] || distances[u] != distances[v] - poids)
+					continue;
+				const unsigned int actuel = predecesseurs[v];
+				if (actuel == AUCUN || distances[u] < distances[actuel] || (distances[u] == distances[actuel] && u < actuel))
+				{
+					predecesseurs[v] = u;
+					poidsNul[p_fil] = poidsNul[p_fil] || poids == 0;
+				}
+			}
+		}
+	});
+	//des sommets à égale distance reliés par des arcs de poids nul peuvent se choisir l'un l'autre
+	if (std::find(poidsNul.begin(), poidsNul.end(), 1) != poidsNul.end())
+		arbreArcsSerres(origine, &distances[0], &predecesseurs[0], vague);
+
+	if (m_versExterne.empty())
+	{
+		p_distances.swap(distances);
+		p_predecesseurs.swap(predecesseurs);
+		return;
+	}
+	p_distances.resize(m_nbSommets);
+	p_predecesseurs.resize(m_nbSommets);
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+	{
+		p_distances[m_versExterne[i]] = distances[i];
+		p_predecesseurs[m_versExterne[i]] = predecesseurs[i] == AUCUN ? AUCUN : m_versExterne[predecesseurs[i]];
+	}
+}
+
+//! \brief Recherche d'une origine vers plusieurs destinations
+//! \param[in] p_destinationsTriees les destinations, triées et sans doublons
+//! \param[in] p_destinations les destinations dans l'ordre de p_distances
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::unAPlusieurs(unsigned int p_origine, const std::vector<unsigned int> & p_destinationsTriees,
+		const std::vector<unsigned int> & p_destinations, N * p_distances,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets);
+	PRECONDITION( p_destinationsTriees.empty() || p_destinationsTriees.back() < m_nbSommets);
+	PRECONDITION( estFige());
+
+	p_contexte.preparer(m_nbSommets, m_arcs.reqPoidsMax());
+	p_contexte.fixer(p_origine, 0, numeric_limits<unsigned int>::max());
+	FilePriorite & lesSommetsARegarder = p_contexte.reqFile();
+	lesSommetsARegarder.insererOuDiminuer(p_origine, 0);
+
+	size_t nbRestantes = p_destinationsTriees.size();
+	while (nbRestantes > 0 && !lesSommetsARegarder.estVide())
+	{
+		N distance;
+		unsigned int sommet = lesSommetsARegarder.extraireMin(distance);
+		if (std::binary_search(p_destinationsTriees.begin(), p_destinationsTriees.end(), sommet) && --nbRestantes == 0)
+			break;
+
+		for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = m_arcs.reqDestination(k);
+			N poidsTotalVoisin = distance + m_arcs.reqPoids(k);
+			if (poidsTotalVoisin < p_contexte.reqDistance(unVoisin))
+			{
+				p_contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				lesSommetsARegarder.insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+		}
+	}
+
+	//toutes les destinations atteignables sont solutionnées: leurs distances sont finales
+	for (size_t j = 0; j < p_destinations.size(); ++j)
+		p_distances[j] = p_contexte.reqDistance(p_destinations[j]);
+}
+
+//! \brief Copie p_sommets dans p_tries, triés et sans doublons
+template<typename T,typename N>
+void Graphe<T,N>::trierSansDoublons(const std::vector<unsigned int> & p_sommets, std::vector<unsigned int> & p_tries)
+{
+	p_tries = p_sommets;
+	std::sort(p_tries.begin(), p_tries.end());
+	p_tries.erase(std::unique(p_tries.begin(), p_tries.end()), p_tries.end());
+}
+
+//! \brief Construit le chemin menant à p_destination à partir des prédécesseurs d'une recherche
+//! \param[out] p_sommets les sommets du chemin, de l'origine à p_destination (le contenu précédent est effacé)
+//! \note le vecteur p_sommets est rempli à rebours puis inversé, ce qui réutilise sa capacité
+template<typename T,typename N>
+template<typename Cle, typename FilePriorite>
+void Graphe<T,N>::construireChemin(const unsigned int p_destination,
+		const ContexteRecherche<Cle, FilePriorite> & p_contexte,
+		std::vector<unsigned int> & p_sommets) const
+{
+	p_sommets.clear();
+	for (unsigned int sommetPrecedent = p_destination; sommetPrecedent != std::numeric_limits<unsigned int>::max(); sommetPrecedent = p_contexte.reqPredecesseur(sommetPrecedent))
+	{
+		p_sommets.push_back(sommetPrecedent);
+	}
+	std::reverse(p_sommets.begin(), p_sommets.end());
+}
+
+
+//! \brief Algorithme de Dijkstra permettant de trouver tous les plus petits chemins d'un point d'origine p_origine.
+//! \param[in] p_origine l'index d'un sommet du graphe.
+//! \param[out] p_distance_minimum Un vecteur de taille qui représente la longueur du plus petit chemin du sommet d'origine au sommet à l'index.
+//! \param[out] p_predecesseur Un vecteur d'index qui représente l'index du sommet précédent l'index dans son chemin le plus court du point d'origine
+//! \pre p_origine doit être un sommet du graph
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::DijkstraCalculerChemins(unsigned int p_origine,
+		std::vector<N>& p_distance_minimum,
+		std::vector<unsigned int>& p_predecesseur) const
+{
+	ContexteRecherche<N, FilePriorite> contexte;
+	DijkstraCalculerChemins(p_origine, numeric_limits<unsigned int>::max(), contexte);
+	contexte.exporter(p_distance_minimum, p_predecesseur);
+}
+
+//! \brief Algorithme de Dijkstra à partir de p_origine, avec arrêt dès que p_destination est solutionné
+//! \param[in] p_origine l'index d'un sommet du graphe.
+//! \param[in] p_destination le sommet à solutionner, ou numeric_limits<unsigned int>::max() pour solutionner tout le graphe
+//! \param[in,out] p_contexte l'espace de travail qui reçoit les distances et prédécesseurs
+//! \pre p_origine doit être un sommet du graph
+//! \note C'est algorithme est une version franciser de celui disponible au http://rosettacode.org/wiki/Dijkstra's_algorithm#C.2B.2B
+//! \note la file de priorité d'origine (std::set) est maintenant une politique parmi d'autres: FileEnsemble
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::DijkstraCalculerChemins(const unsigned int p_origine, const unsigned int p_destination,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	DijkstraCalculerChemins(p_origine, p_destination, m_arcs, p_contexte);
+}
+
+//! \brief Algorithme de Dijkstra qui ignore les sommets et les arcs masqués
+//! \brief un sommet (ou un arc) est masqué si sa marque dans p_marqueSommets (ou p_marqueArcs) vaut p_marqueSommet
+//! \brief (ou p_marqueArc); p_origine ne doit pas être masqué
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::dijkstraMasque(const unsigned int p_origine, const unsigned int p_destination,
+		const std::vector<unsigned int> & p_marqueSommets, unsigned int p_marqueSommet,
+		const std::vector<unsigned int> & p_marqueArcs, unsigned int p_marqueArc,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets && p_marqueSommets[p_origine] != p_marqueSommet);
+	p_contexte.preparer(m_nbSommets, m_arcs.reqPoidsMax());
+	p_contexte.fixer(p_origine, 0, numeric_limits<unsigned int>::max());
+
+	FilePriorite & lesSommetsARegarder = p_contexte.reqFile();
+	lesSommetsARegarder.insererOuDiminuer(p_origine, 0);
+	while (!lesSommetsARegarder.estVide())
+	{
+		N distance;
+		unsigned int sommet = lesSommetsARegarder.extraireMin(distance);
+		if (sommet == p_destination)
+			break;
+
+		for (unsigned int k = m_arcs.reqDebut(sommet), fin = m_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = m_arcs.reqDestination(k);
+			if (p_marqueArcs[k] == p_marqueArc || p_marqueSommets[unVoisin] == p_marqueSommet)
+				continue;
+			N poidsTotalVoisin = distance + m_arcs.reqPoids(k);
+			if (poidsTotalVoisin < p_contexte.reqDistance(unVoisin))
+			{
+				p_contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				lesSommetsARegarder.insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+		}
+	}
+}
+
+//! \brief Algorithme de Dijkstra sur un ensemble d'arcs donné: m_arcs pour une recherche avant,
+//! \brief m_arcsInverses pour une recherche arrière (distances vers p_origine)
+template<typename T,typename N>
+template<typename FilePriorite>
+void Graphe<T,N>::DijkstraCalculerChemins(const unsigned int p_origine, const unsigned int p_destination,
+		const GrapheCSR<N> & p_arcs,
+		ContexteRecherche<N, FilePriorite> & p_contexte) const
+{
+	PRECONDITION( p_origine < m_nbSommets);
+	p_contexte.preparer(m_nbSommets, p_arcs.reqPoidsMax());
+	p_contexte.fixer(p_origine, 0, numeric_limits<unsigned int>::max());
+
+	FilePriorite & lesSommetsARegarder = p_contexte.reqFile();
+	lesSommetsARegarder.insererOuDiminuer(p_origine, 0);
+	INSTRUMENTER_AMELIORATION(true);
+	
+	while (!lesSommetsARegarder.estVide())
+	{
+		//Obtenir le sommet de distance minimale.
+		N distance;
+		unsigned int sommet = lesSommetsARegarder.extraireMin(distance);
+		INSTRUMENTER_SOLUTIONNE();
+		if (sommet == p_destination)
+			break; //terminer dijkstra car on a solutionné p_destination
+		
+		//Visite chaque arc sortant du sommet;
+		for (unsigned int k = p_arcs.reqDebut(sommet), fin = p_arcs.reqFin(sommet); k < fin; ++k)
+		{
+			unsigned int unVoisin = p_arcs.reqDestination(k);
+			N poidsVoisin = p_arcs.reqPoids(k);
+			N poidsTotalVoisin = distance+poidsVoisin;
+			INSTRUMENTER_RELACHE();
+			if (poidsTotalVoisin < p_contexte.reqDistance(unVoisin))
+			{
+				INSTRUMENTER_AMELIORATION(!p_contexte.estAtteint(unVoisin));
+				p_contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				lesSommetsARegarder.insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+		}
+	}
+
+}
@@ -0,0 +1,217 @@
+/**
+ * \file   GrapheBinaire.cpp
+ * \brief  Fichier contenant l'implémentation des fonctions de lecture et d'écriture d'un graphe en format binaire
+ */
+
+#include "GrapheBinaire.h"
+#include "FichierProjete.h"
+#include "Instrumentation.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+#include <memory>
+#include <stdint.h>
+
+using namespace std;
+
+namespace {
+const char SIGNATURE[4] = { 'G', 'R', 'P', 'B' };
+const uint32_t VERSION = 2;
+const uint32_t MARQUEUR_ORDRE = 0x01020304;
+
+//! \brief en-tête du fichier, qui suit la signature
+struct entete {
+	uint32_t version;
+	uint32_t marqueurOrdre;
+	uint32_t nbSommets;
+	uint32_t nbArcs;
+	uint32_t poidsMax;
+	uint32_t tailleNoms;
+	uint32_t renumerote; /*!< 1 si les numéros externes des sommets suivent les arcs inverses, 0 sinon */
+	uint32_t attente;    /*!< délai d'attente ajouté au coût de chaque arc par chargerGrapheTexte() */
+};
+
+void ecrire(ofstream & p_sortie, const uint32_t * p_tableau, size_t p_nombre) {
+	if (p_nombre > 0)
+		p_sortie.write(reinterpret_cast<const char *>(p_tableau), p_nombre * sizeof(uint32_t));
+}
+
+void ecrireCSR(ofstream & p_sortie, const GrapheCSR<unsigned int> & p_arcs) {
+	ecrire(p_sortie, p_arcs.reqDebuts(), p_arcs.reqNbSommets() + 1);
+	ecrire(p_sortie, p_arcs.reqDestinations(), p_arcs.reqNbArcs());
+	ecrire(p_sortie, p_arcs.reqTableauPoids(), p_arcs.reqNbArcs());
+}
+
+/**
+ * \brief Vérifie qu'un tableau de p_nombre+1 débuts est croissant de 0 à p_fin
+ */
+bool estCroissant(const uint32_t * p_debuts, uint32_t p_nombre, uint32_t p_fin) {
+	if (p_debuts[0] != 0 || p_debuts[p_nombre] != p_fin)
+		return false;
+	for (uint32_t i = 0; i < p_nombre; ++i)
+		if (p_debuts[i] > p_debuts[i + 1])
+			return false;
+	return true;
+}
+
+/**
+ * \brief Vérifie que p_nombre numéros forment une permutation de 0 à p_nombre - 1
+ */
+bool estPermutation(const uint32_t * p_numeros, uint32_t p_nombre) {
+	vector<bool> estVu(p_nombre, false);
+	for (uint32_t i = 0; i < p_nombre; ++i) {
+		if (p_numeros[i] >= p_nombre || estVu[p_numeros[i]])
+			return false;
+		estVu[p_numeros[i]] = true;
+	}
+	return true;
+}
+
+/**
+ * \brief Vérifie les débuts d'un CSR, que toutes les destinations sont des sommets valides, qu'aucune
+ *        origine n'a deux arcs vers la même destination (Graphe::figer() les fusionne) et qu'aucun
+ *        poids ne dépasse p_poidsMax (la file de Dial et le delta-stepping s'y fient)
+ */
+bool estCSRValide(const uint32_t * p_debuts, const uint32_t * p_destinations, const uint32_t * p_poids,
+		uint32_t p_nbSommets, uint32_t p_nbArcs, uint32_t p_poidsMax) {
+	if (!estCroissant(p_debuts, p_nbSommets, p_nbArcs))
+		return false;
+	vector<uint32_t> derniereOrigine(p_nbSommets, 0); //origine + 1 du dernier arc vu vers chaque sommet
+	uint32_t poidsMax = 0;
+	for (uint32_t i = 0; i < p_nbSommets; ++i)
+		for (uint32_t k = p_debuts[i]; k < p_debuts[i + 1]; ++k) {
+			if (p_destinations[k] >= p_nbSommets || derniereOrigine[p_destinations[k]] == i + 1)
+				return false;
+			derniereOrigine[p_destinations[k]] = i + 1;
+			if (p_poids[k] > poidsMax)
+				poidsMax = p_poids[k];
+		}
+	return poidsMax <= p_poidsMax;
+}
+
+/**
+ * \brief Vérifie que le CSR inverse contient exactement les arcs du CSR avant, retournés, avec les mêmes poids
+ * \note les arcs entrant dans un sommet doivent être rangés par origine croissante, comme les range
+ *       GrapheCSR::transposer(): un seul passage sur les arcs suffit, avec un curseur par sommet
+ * \pre les deux CSR ont été validés par estCSRValide()
+ */
+bool estTransposee(const uint32_t * p_debuts, const uint32_t * p_destinations, const uint32_t * p_poids,
+		const uint32_t * p_debutsInverses, const uint32_t * p_origines, const uint32_t * p_poidsInverses,
+		uint32_t p_nbSommets) {
+	vector<uint32_t> curseurs(p_debutsInverses, p_debutsInverses + p_nbSommets);
+	for (uint32_t i = 0; i < p_nbSommets; ++i)
+		for (uint32_t k = p_debuts[i]; k < p_debuts[i + 1]; ++k) {
+			uint32_t & curseur = curseurs[p_destinations[k]];
+			if (curseur == p_debutsInverses[p_destinations[k] + 1] || p_origines[curseur] != i
+					|| p_poidsInverses[curseur] != p_poids[k])
+				return false;
+			++curseur;
+		}
+	return true;
+}
+}
+
+/**
+ * \brief Écrit un graphe figé en format binaire
+ * \param[in] p_graphe le graphe, dont les arcs doivent être figés
+ * \param[in] p_nomFichier le fichier à créer (remplacé s'il existe)
+ * \param[in] p_attente le délai d'attente compris dans les poids (voir chargerGrapheTexte())
+ */
+void sauvegarderGrapheBinaire(const Graphe<string, unsigned int> & p_graphe, const string & p_nomFichier,
+		unsigned int p_attente) {
+	PRECONDITION(p_graphe.estFige());
+
+	const GrapheCSR<unsigned int> & arcs = p_graphe.reqArcs();
+	const uint32_t nbSommets = p_graphe.reqNbSommets();
+
+	//les arcs sont écrits dans l'ordre interne: les noms aussi
+	vector<uint32_t> debutsNoms(nbSommets + 1, 0);
+	vector<uint32_t> externes(p_graphe.estRenumerote() ? nbSommets : 0);
+	string noms;
+	for (uint32_t i = 0; i < nbSommets; ++i) {
+		noms += p_graphe.reqNom(p_graphe.reqExterne(i));
+		debutsNoms[i + 1] = noms.size();
+		if (!externes.empty())
+			externes[i] = p_graphe.reqExterne(i);
+	}
+
+	entete e = { VERSION, MARQUEUR_ORDRE, nbSommets, (uint32_t) arcs.reqNbArcs(), arcs.reqPoidsMax(),
+			(uint32_t) noms.size(), externes.empty() ? 0u : 1u, p_attente };
+
+	ofstream sortie(p_nomFichier.c_str(), ios::binary | ios::trunc);
+	if (!sortie)
+		throw logic_error("sauvegarderGrapheBinaire(): impossible de créer " + p_nomFichier);
+	sortie.write(SIGNATURE, sizeof(SIGNATURE));
+	sortie.write(reinterpret_cast<const char *>(&e), sizeof(e));
+	ecrireCSR(sortie, arcs);
+	ecrireCSR(sortie, p_graphe.reqArcsInverses());
+	ecrire(sortie, externes.data(), externes.size());
+	ecrire(sortie, &debutsNoms[0], debutsNoms.size());
+	sortie.write(noms.data(), noms.size());
+	if (!sortie)
+		throw logic_error("sauvegarderGrapheBinaire(): l'écriture a échoué");
+}
+
+/**
+ * \brief Lit un graphe écrit par sauvegarderGrapheBinaire()
+ * \brief le fichier est projeté en mémoire: les arcs sont utilisés en place, sans copie;
+ * \brief la projection reste en vie tant qu'une copie du graphe existe
+ * \param[in] p_nomFichier le fichier à lire
+ * \param[in] p_attente le délai d'attente attendu dans les poids; un fichier écrit avec un autre délai est refusé
+ * \return le graphe, figé
+ * \post en cas d'erreur (fichier absent, tronqué ou incohérent: poids au-delà du poids maximal annoncé,
+ *       arcs inverses qui ne sont pas la transposée des arcs...), une exception est levée
+ */
+Graphe<string, unsigned int> chargerGrapheBinaire(const string & p_nomFichier, unsigned int p_attente) {
+	INSTRUMENTER_PHASE(phase, "binaire: projection");
+	shared_ptr<FichierProjete> fichier(new FichierProjete(p_nomFichier));
+	const char * donnees = fichier->reqDonnees();
+	const size_t taille = fichier->reqTaille();
+
+	if (taille < sizeof(SIGNATURE) + sizeof(entete) || memcmp(donnees, SIGNATURE, sizeof(SIGNATURE)) != 0)
+		throw logic_error("chargerGrapheBinaire(): ce n'est pas un graphe binaire");
+	entete e;
+	memcpy(&e, donnees + sizeof(SIGNATURE), sizeof(e));
+	if (e.version != VERSION)
+		throw logic_error("chargerGrapheBinaire(): version de fichier non supportée");
+	if (e.marqueurOrdre != MARQUEUR_ORDRE)
+		throw logic_error("chargerGrapheBinaire(): fichier écrit sur une machine d'un autre boutisme");
+	if (e.renumerote > 1)
+		throw logic_error("chargerGrapheBinaire(): en-tête incohérent");
+	if (e.attente != p_attente)
+		throw logic_error("chargerGrapheBinaire(): les poids ont été calculés avec un autre délai d'attente");
+
+	const uint64_t n = e.nbSommets, m = e.nbArcs;
+	const uint64_t nbExternes = e.renumerote ? n : 0;
+	const uint64_t nbEntiers = 2 * (n + 1 + 2 * m) + nbExternes + (n + 1);
+	if (taille != sizeof(SIGNATURE) + sizeof(entete) + nbEntiers * sizeof(uint32_t) + e.tailleNoms)
+		throw logic_error("chargerGrapheBinaire(): taille de fichier incohérente");
+
+	const uint32_t * debuts = reinterpret_cast<const uint32_t *>(donnees + sizeof(SIGNATURE) + sizeof(entete));
+	const uint32_t * destinations = debuts + n + 1;
+	const uint32_t * poids = destinations + m;
+	const uint32_t * debutsInverses = poids + m;
+	const uint32_t * destinationsInverses = debutsInverses + n + 1;
+	const uint32_t * poidsInverses = destinationsInverses + m;
+	const uint32_t * externes = poidsInverses + m;
+	const uint32_t * debutsNoms = externes + nbExternes;
+	const char * noms = reinterpret_cast<const char *>(debutsNoms + n + 1);
+
+	INSTRUMENTER_ENCHAINER(phase, "binaire: validation");
+	if (!estCSRValide(debuts, destinations, poids, e.nbSommets, e.nbArcs, e.poidsMax)
+			|| !estCSRValide(debutsInverses, destinationsInverses, poidsInverses, e.nbSommets, e.nbArcs, e.poidsMax)
+			|| !estTransposee(debuts, destinations, poids, debutsInverses, destinationsInverses, poidsInverses, e.nbSommets)
+			|| !estCroissant(debutsNoms, e.nbSommets, e.tailleNoms)
+			|| (e.renumerote && !estPermutation(externes, e.nbSommets)))
+		throw logic_error("chargerGrapheBinaire(): arcs ou noms incohérents");
+
+	INSTRUMENTER_ENCHAINER(phase, "binaire: noms");
+	vector<string> listeNoms(n);
+	for (uint32_t i = 0; i < n; ++i)
+		listeNoms[i].assign(noms + debutsNoms[i], debutsNoms[i + 1] - debutsNoms[i]);
+
+	GrapheCSR<unsigned int> arcs(n, m, debuts, destinations, poids, e.poidsMax, fichier);
+	GrapheCSR<unsigned int> arcsInverses(n, m, debutsInverses, destinationsInverses, poidsInverses, e.poidsMax, fichier);
+	return Graphe<string, unsigned int>(listeNoms, arcs, arcsInverses, vector<unsigned int>(externes, externes + nbExternes));
+}
@@ -0,0 +1,29 @@
+/**
+ * \file   GrapheBinaire.h
+ * \brief  Fichier contenant la déclaration des fonctions de lecture et d'écriture d'un graphe en format binaire
+ *
+ * Le fichier est une suite d'entiers de 32 bits dans l'ordre natif de la machine:
+ *  - l'en-tête: signature "GRPB", version, marqueur d'ordre des octets (0x01020304),
+ *    nombre de sommets n, nombre d'arcs m, poids maximal, taille de la table des noms,
+ *    1 si le graphe est renuméroté (0 sinon), délai d'attente compris dans les poids;
+ *  - les arcs en format CSR: n+1 débuts, m destinations, m poids;
+ *  - les arcs inverses, dans le même format;
+ *  - si le graphe est renuméroté, le numéro externe de chaque sommet (n entiers);
+ *  - n+1 positions de début dans la table des noms, puis la table des noms (UTF-8, sans terminateur).
+ * Les arcs et les noms sont rangés dans l'ordre interne des sommets (voir Graphe::renumeroter()).
+ * Tous les tableaux sont alignés sur 4 octets, ce qui permet de les utiliser directement
+ * dans le fichier projeté en mémoire, sans copie ni analyse.
+ */
+
+#ifndef GRAPHEBINAIRE_H
+#define GRAPHEBINAIRE_H
+
+#include <string>
+
+#include "Graphe.h"
+
+void sauvegarderGrapheBinaire(const Graphe<std::string, unsigned int> & p_graphe, const std::string & p_nomFichier,
+		unsigned int p_attente);
+Graphe<std::string, unsigned int> chargerGrapheBinaire(const std::string & p_nomFichier, unsigned int p_attente);
+
+#endif
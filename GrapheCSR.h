@@ -0,0 +1,90 @@
+//
+//  GrapheCSR.h
+//  représentation compacte (compressed sparse row) des arcs d'un graphe orienté valué
+//
+
+#ifndef GRAPHECSR_H
+#define GRAPHECSR_H
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <stdint.h>
+
+#include "ContratException.h"
+
+//! \brief Patron de classe pour l'ensemble figé des arcs d'un graphe en format CSR
+//! \brief les arcs sortant du sommet i occupent les index [reqDebut(i), reqFin(i)[
+//! \brief les destinations et les poids sont stockés dans deux tableaux séparés (struct-of-arrays)
+//! \brief les tableaux sont partagés entre les copies; ils peuvent appartenir à l'objet ou à un stockage
+//! \brief externe (par exemple un fichier projeté en mémoire) gardé en vie par m_proprietaire
+//! \brief modifierPoids() et retirerArc() copient d'abord les tableaux s'ils sont partagés ou externes
+//! \brief N est le type pour les poids
+template <typename N>
+class GrapheCSR
+{
+public:
+
+	struct arc
+	{
+		unsigned int origine;
+		unsigned int destination;
+		N poids;
+		arc(unsigned int p_origine, unsigned int p_destination, N p_poids)
+			: origine(p_origine), destination(p_destination), poids(p_poids){}
+	};
+
+	GrapheCSR();
+	GrapheCSR(size_t p_nbSommets, const std::vector<arc> & p_arcs);
+	GrapheCSR(size_t p_nbSommets, size_t p_nbArcs, const unsigned int * p_debuts,
+			const unsigned int * p_destinations, const N * p_poids, const N & p_poidsMax,
+			const std::shared_ptr<const void> & p_proprietaire);
+
+	size_t reqNbSommets() const;
+	size_t reqNbArcs() const;
+
+	unsigned int reqDebut(unsigned int i) const;
+	unsigned int reqFin(unsigned int i) const;
+	unsigned int reqDestination(unsigned int k) const;
+	const N & reqPoids(unsigned int k) const;
+	const N & reqPoidsMax() const;
+	const unsigned int * reqDebuts() const;
+	const unsigned int * reqDestinations() const;
+	const N * reqTableauPoids() const;
+	unsigned int trouverArc(unsigned int i, unsigned int j) const;
+	uint64_t calculerEmpreinte() const;
+
+	void modifierPoids(unsigned int k, const N & p_poids);
+	void retirerArc(unsigned int k);
+
+	void listerArcs(std::vector<arc> & p_arcs) const;
+	GrapheCSR transposer() const;
+	GrapheCSR fusionnerDoublons() const;
+
+private:
+	//! \brief stockage des tableaux quand ils appartiennent au graphe
+	struct stockage
+	{
+		std::vector<unsigned int> debuts;
+		std::vector<unsigned int> destinations;
+		std::vector<N> poids;
+	};
+
+	void adopter(const std::shared_ptr<stockage> & p_stockage);
+	static void melanger(uint64_t & p_empreinte, const void * p_donnees, size_t p_taille);
+	void detacher();
+
+	size_t m_nbSommets;
+	size_t m_nbArcs;
+	const unsigned int * m_debuts;       /*!< n+1 index: début des arcs sortant de chaque sommet */
+	const unsigned int * m_destinations; /*!< destination de chaque arc */
+	const N * m_poids;                   /*!< poids de chaque arc */
+	N m_poidsMax;                        /*!< le plus grand poids d'arc (0 s'il n'y a aucun arc); après une modification, une borne supérieure */
+	std::shared_ptr<stockage> m_stockage;       /*!< les tableaux, s'ils appartiennent à l'objet et à ses copies */
+	std::shared_ptr<const void> m_proprietaire; /*!< garde en vie la mémoire des tableaux externes */
+};
+
+
+#include "GrapheCSR.hpp"
+
+#endif
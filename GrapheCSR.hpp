@@ -0,0 +1,295 @@
+//
+//  GrapheCSR.hpp
+//  représentation compacte (compressed sparse row) des arcs d'un graphe orienté valué
+//
+
+#include <algorithm>
+#include <limits>
+
+#include "GrapheCSR.h"
+
+//! \brief		Constructeur sans paramètre
+//! \post		Un ensemble d'arcs vide sur 0 sommet est créé
+template<typename N>
+GrapheCSR<N>::GrapheCSR() : m_nbSommets(0), m_nbArcs(0), m_poidsMax(0)
+{
+	std::shared_ptr<stockage> tableaux(new stockage);
+	tableaux->debuts.assign(1, 0);
+	adopter(tableaux);
+}
+
+//! \brief		Constructeur à partir d'une liste d'arcs quelconque
+//! \brief		les arcs sont regroupés par origine par un tri par dénombrement stable:
+//! \brief		l'ordre relatif des arcs d'un même sommet est celui de p_arcs
+//! \param[in]	p_nbSommets le nombre de sommets du graphe
+//! \param[in]	p_arcs les arcs du graphe
+//! \pre		les extrémités de chaque arc doivent être des sommets du graphe
+template<typename N>
+GrapheCSR<N>::GrapheCSR(size_t p_nbSommets, const std::vector<arc> & p_arcs)
+	: m_nbSommets(p_nbSommets), m_nbArcs(p_arcs.size()), m_poidsMax(0)
+{
+	std::shared_ptr<stockage> tableaux(new stockage);
+	tableaux->debuts.assign(p_nbSommets + 1, 0);
+	tableaux->destinations.resize(p_arcs.size());
+	tableaux->poids.resize(p_arcs.size());
+
+	std::vector<unsigned int> & debuts = tableaux->debuts;
+	for (typename std::vector<arc>::const_iterator itr = p_arcs.begin(); itr != p_arcs.end(); ++itr)
+	{
+		PRECONDITION(itr->origine < m_nbSommets && itr->destination < m_nbSommets);
+		++debuts[itr->origine + 1];
+		if (m_poidsMax < itr->poids)
+			m_poidsMax = itr->poids;
+	}
+	for (size_t i = 0; i < m_nbSommets; ++i)
+		debuts[i + 1] += debuts[i];
+
+	std::vector<unsigned int> prochain(debuts.begin(), debuts.end() - 1);
+	for (typename std::vector<arc>::const_iterator itr = p_arcs.begin(); itr != p_arcs.end(); ++itr)
+	{
+		unsigned int k = prochain[itr->origine]++;
+		tableaux->destinations[k] = itr->destination;
+		tableaux->poids[k] = itr->poids;
+	}
+	adopter(tableaux);
+}
+
+//! \brief		Constructeur sur des tableaux CSR existants, sans copie
+//! \param[in]	p_nbSommets le nombre de sommets du graphe
+//! \param[in]	p_nbArcs le nombre d'arcs du graphe
+//! \param[in]	p_debuts p_nbSommets+1 index de début, p_debuts[p_nbSommets] == p_nbArcs
+//! \param[in]	p_destinations p_nbArcs destinations
+//! \param[in]	p_poids p_nbArcs poids
+//! \param[in]	p_poidsMax le plus grand des poids
+//! \param[in]	p_proprietaire l'objet qui possède la mémoire des tableaux; il est gardé en vie par toutes les copies
+template<typename N>
+GrapheCSR<N>::GrapheCSR(size_t p_nbSommets, size_t p_nbArcs, const unsigned int * p_debuts,
+		const unsigned int * p_destinations, const N * p_poids, const N & p_poidsMax,
+		const std::shared_ptr<const void> & p_proprietaire)
+	: m_nbSommets(p_nbSommets), m_nbArcs(p_nbArcs), m_debuts(p_debuts), m_destinations(p_destinations),
+	  m_poids(p_poids), m_poidsMax(p_poidsMax), m_proprietaire(p_proprietaire)
+{
+	PRECONDITION(p_debuts != 0 && p_debuts[p_nbSommets] == p_nbArcs);
+}
+
+//! \brief		Fait pointer les tableaux sur un stockage appartenant à l'objet
+template<typename N>
+void GrapheCSR<N>::adopter(const std::shared_ptr<stockage> & p_stockage)
+{
+	m_debuts = p_stockage->debuts.data();
+	m_destinations = p_stockage->destinations.data();
+	m_poids = p_stockage->poids.data();
+	m_stockage = p_stockage;
+	m_proprietaire.reset();
+}
+
+//! \brief		Copie les tableaux dans un stockage propre à l'objet s'ils sont partagés avec une copie
+//! \brief		ou externes, avant une modification
+template<typename N>
+void GrapheCSR<N>::detacher()
+{
+	if (m_stockage && m_stockage.use_count() == 1)
+		return;
+	std::shared_ptr<stockage> tableaux(new stockage);
+	tableaux->debuts.assign(m_debuts, m_debuts + m_nbSommets + 1);
+	tableaux->destinations.assign(m_destinations, m_destinations + m_nbArcs);
+	tableaux->poids.assign(m_poids, m_poids + m_nbArcs);
+	adopter(tableaux);
+}
+
+//! \brief		Obtient le nombre de sommets
+template<typename N>
+size_t GrapheCSR<N>::reqNbSommets() const
+{
+	return m_nbSommets;
+}
+
+//! \brief		Obtient le nombre d'arcs
+template<typename N>
+size_t GrapheCSR<N>::reqNbArcs() const
+{
+	return m_nbArcs;
+}
+
+//! \brief		Obtient l'index du premier arc sortant du sommet i
+template<typename N>
+unsigned int GrapheCSR<N>::reqDebut(unsigned int i) const
+{
+	return m_debuts[i];
+}
+
+//! \brief		Obtient l'index suivant le dernier arc sortant du sommet i
+template<typename N>
+unsigned int GrapheCSR<N>::reqFin(unsigned int i) const
+{
+	return m_debuts[i + 1];
+}
+
+//! \brief		Obtient la destination de l'arc k
+//! \note		aucune précondition: appelé dans la boucle de relaxation
+template<typename N>
+unsigned int GrapheCSR<N>::reqDestination(unsigned int k) const
+{
+	return m_destinations[k];
+}
+
+//! \brief		Obtient le poids de l'arc k
+//! \note		aucune précondition: appelé dans la boucle de relaxation
+template<typename N>
+const N & GrapheCSR<N>::reqPoids(unsigned int k) const
+{
+	return m_poids[k];
+}
+
+//! \brief		Obtient le plus grand poids d'arc
+template<typename N>
+const N & GrapheCSR<N>::reqPoidsMax() const
+{
+	return m_poidsMax;
+}
+
+//! \brief		Obtient le tableau des n+1 index de début (pour l'écriture en binaire)
+template<typename N>
+const unsigned int * GrapheCSR<N>::reqDebuts() const
+{
+	return m_debuts;
+}
+
+//! \brief		Obtient le tableau des destinations
+template<typename N>
+const unsigned int * GrapheCSR<N>::reqDestinations() const
+{
+	return m_destinations;
+}
+
+//! \brief		Obtient le tableau des poids
+template<typename N>
+const N * GrapheCSR<N>::reqTableauPoids() const
+{
+	return m_poids;
+}
+
+//! \brief		Cherche l'arc i -> j
+//! \return		l'index de l'arc, ou numeric_limits<unsigned int>::max() s'il n'existe pas
+//! \note		linéaire dans le nombre d'arcs sortant de i
+template<typename N>
+unsigned int GrapheCSR<N>::trouverArc(unsigned int i, unsigned int j) const
+{
+	PRECONDITION(i < m_nbSommets);
+	for (unsigned int k = m_debuts[i]; k < m_debuts[i + 1]; ++k)
+		if (m_destinations[k] == j)
+			return k;
+	return std::numeric_limits<unsigned int>::max();
+}
+
+//! \brief		Calcule une empreinte des arcs: FNV-1a 64 bits du nombre de sommets et d'arcs, des index de
+//! \brief		début, des destinations et des poids (octet par octet)
+//! \note		sert à reconnaître un prétraitement enregistré pour d'autres arcs; linéaire dans le nombre d'arcs
+template<typename N>
+uint64_t GrapheCSR<N>::calculerEmpreinte() const
+{
+	uint64_t empreinte = 14695981039346656037ULL;
+	const uint64_t tailles[2] = { m_nbSommets, m_nbArcs };
+	melanger(empreinte, tailles, sizeof(tailles));
+	melanger(empreinte, m_debuts, (m_nbSommets + 1) * sizeof(unsigned int));
+	if (m_nbArcs > 0)
+	{
+		melanger(empreinte, m_destinations, m_nbArcs * sizeof(unsigned int));
+		melanger(empreinte, m_poids, m_nbArcs * sizeof(N));
+	}
+	return empreinte;
+}
+
+//! \brief		Ajoute p_taille octets à une empreinte FNV-1a
+template<typename N>
+void GrapheCSR<N>::melanger(uint64_t & p_empreinte, const void * p_donnees, size_t p_taille)
+{
+	const unsigned char * octets = static_cast<const unsigned char *>(p_donnees);
+	for (size_t i = 0; i < p_taille; ++i)
+		p_empreinte = (p_empreinte ^ octets[i]) * 1099511628211ULL;
+}
+
+//! \brief		Change le poids de l'arc k
+//! \post		reqPoidsMax() reste une borne supérieure des poids
+template<typename N>
+void GrapheCSR<N>::modifierPoids(unsigned int k, const N & p_poids)
+{
+	PRECONDITION(k < m_nbArcs);
+	detacher();
+	m_stockage->poids[k] = p_poids;
+	if (m_poidsMax < p_poids)
+		m_poidsMax = p_poids;
+}
+
+//! \brief		Retire l'arc k; les arcs suivants sont décalés d'un index
+//! \note		linéaire dans le nombre d'arcs et de sommets
+template<typename N>
+void GrapheCSR<N>::retirerArc(unsigned int k)
+{
+	PRECONDITION(k < m_nbArcs);
+	detacher();
+	std::vector<unsigned int> & debuts = m_stockage->debuts;
+	//origine de l'arc k: le dernier sommet dont le début est <= k
+	unsigned int origine = std::upper_bound(debuts.begin(), debuts.end(), k) - debuts.begin() - 1;
+	for (size_t i = origine + 1; i <= m_nbSommets; ++i)
+		--debuts[i];
+	m_stockage->destinations.erase(m_stockage->destinations.begin() + k);
+	m_stockage->poids.erase(m_stockage->poids.begin() + k);
+	--m_nbArcs;
+	adopter(m_stockage);
+}
+
+//! \brief		Reconstruit la liste des arcs, regroupés par origine
+//! \param[out]	p_arcs les arcs du graphe (le contenu précédent est effacé)
+template<typename N>
+void GrapheCSR<N>::listerArcs(std::vector<arc> & p_arcs) const
+{
+	p_arcs.clear();
+	p_arcs.reserve(reqNbArcs());
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+		for (unsigned int k = m_debuts[i]; k < m_debuts[i + 1]; ++k)
+			p_arcs.push_back(arc(i, m_destinations[k], m_poids[k]));
+}
+
+//! \brief		Fusionne les arcs i -> j répétés: le premier prend le poids du dernier, les autres sont retirés
+//! \brief		(comme l'écrasement d'une case de la matrice de valuation); l'ordre des arcs restants est gardé
+//! \return		les arcs sans doublons (une copie partagée de ceux-ci s'il n'y en avait aucun)
+//! \note		linéaire dans le nombre d'arcs et de sommets
+template<typename N>
+GrapheCSR<N> GrapheCSR<N>::fusionnerDoublons() const
+{
+	//premierArc[j] est la position du premier arc i -> j pour l'origine i courante
+	const unsigned int AUCUN = std::numeric_limits<unsigned int>::max();
+	std::vector<unsigned int> premierArc(m_nbSommets, AUCUN);
+	std::vector<arc> sansDoublons;
+	sansDoublons.reserve(m_nbArcs);
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+	{
+		size_t debut = sansDoublons.size();
+		for (unsigned int k = m_debuts[i]; k < m_debuts[i + 1]; ++k)
+		{
+			unsigned int j = m_destinations[k];
+			if (premierArc[j] != AUCUN && premierArc[j] >= debut)
+				sansDoublons[premierArc[j]].poids = m_poids[k];
+			else
+			{
+				premierArc[j] = sansDoublons.size();
+				sansDoublons.push_back(arc(i, j, m_poids[k]));
+			}
+		}
+	}
+	return sansDoublons.size() == m_nbArcs ? *this : GrapheCSR(m_nbSommets, sansDoublons);
+}
+
+//! \brief		Construit le graphe inverse: chaque arc i -> j devient j -> i, avec le même poids
+//! \return		les arcs inverses; les arcs entrant dans j y sont rangés par origine croissante
+template<typename N>
+GrapheCSR<N> GrapheCSR<N>::transposer() const
+{
+	std::vector<arc> arcsInverses;
+	arcsInverses.reserve(reqNbArcs());
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+		for (unsigned int k = m_debuts[i]; k < m_debuts[i + 1]; ++k)
+			arcsInverses.push_back(arc(m_destinations[k], i, m_poids[k]));
+	return GrapheCSR(m_nbSommets, arcsInverses);
+}
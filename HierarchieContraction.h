@@ -0,0 +1,102 @@
+//
+//  HierarchieContraction.h
+//  hiérarchie de contraction (contraction hierarchies) pour les requêtes de plus court chemin répétées
+//
+
+#ifndef HIERARCHIECONTRACTION_H
+#define HIERARCHIECONTRACTION_H
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+#include "ContratException.h"
+#include "GrapheCSR.h"
+#include "FilePriorite.h"
+#include "ContexteRecherche.h"
+#include "BassinFils.h"
+
+//! \brief Patron de classe pour une hiérarchie de contraction construite à partir des arcs d'un graphe
+//! \brief Les sommets sont contractés un à un, du moins important au plus important; contracter v
+//! \brief ajoute un raccourci u -> w pour chaque chemin u -> v -> w qui est le seul plus court chemin
+//! \brief entre u et w parmi les sommets restants. Une requête est une recherche bidirectionnelle
+//! \brief qui ne suit que des arcs montant vers des sommets de rang plus élevé.
+//! \brief N est le type pour les poids
+template <typename N>
+class HierarchieContraction
+{
+public:
+	HierarchieContraction();
+
+	void construire(const GrapheCSR<N> & p_arcs, unsigned long p_version = 0);
+
+	size_t reqNbSommets() const;
+	size_t reqNbRaccourcis() const;
+	unsigned int reqRang(unsigned int p_sommet) const;
+	unsigned long reqVersion() const;
+
+	template <typename FilePriorite>
+	N requete(unsigned int p_origine, unsigned int p_destination, std::vector<unsigned int> & p_chemin,
+			ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+			ContexteRecherche<N, FilePriorite> & p_contexteArriere) const;
+
+	template <typename FilePriorite>
+	void matriceDistances(const std::vector<unsigned int> & p_origines, const std::vector<unsigned int> & p_destinations,
+			N * p_matrice, BassinFils & p_bassin) const;
+
+private:
+	//! \brief arc de la hiérarchie: milieu est le sommet contracté qu'il court-circuite (AUCUN pour un arc d'origine)
+	struct arcCH
+	{
+		unsigned int voisin;
+		N poids;
+		unsigned int milieu;
+		arcCH(unsigned int p_voisin, N p_poids, unsigned int p_milieu)
+			: voisin(p_voisin), poids(p_poids), milieu(p_milieu){}
+	};
+
+	//! \brief arcs montants en format CSR; les trois tableaux partagent les mêmes index
+	struct arcsMontants
+	{
+		std::vector<unsigned int> debuts;
+		std::vector<unsigned int> voisins;
+		std::vector<N> poids;
+		std::vector<unsigned int> milieux;
+	};
+
+	typedef std::vector< std::vector<arcCH> > listeArcs;
+
+	static void ajouterOuRaccourcir(std::vector<arcCH> & p_liste, unsigned int p_voisin, N p_poids, unsigned int p_milieu);
+	static void retirer(std::vector<arcCH> & p_liste, unsigned int p_voisin);
+	static void ranger(size_t p_nbSommets, const listeArcs & p_listes, arcsMontants & p_arcs);
+
+	unsigned int simulerContraction(unsigned int p_sommet, const listeArcs & p_sortants, const listeArcs & p_entrants,
+			const std::vector<bool> & p_estContracte, ContexteRecherche<N> & p_contexte,
+			std::vector<typename GrapheCSR<N>::arc> * p_raccourcis) const;
+	int priorite(unsigned int p_sommet, const listeArcs & p_sortants, const listeArcs & p_entrants,
+			const std::vector<bool> & p_estContracte, const std::vector<unsigned int> & p_nbVoisinsContractes,
+			ContexteRecherche<N> & p_contexte) const;
+
+	template <typename FilePriorite>
+	void explorerMontant(unsigned int p_source, const arcsMontants & p_montants, const arcsMontants & p_descendants,
+			ContexteRecherche<N, FilePriorite> & p_contexte, std::vector< std::pair<unsigned int, N> > & p_atteints) const;
+
+	unsigned int trouverMilieu(unsigned int p_origine, unsigned int p_destination) const;
+	void deplier(unsigned int p_origine, unsigned int p_destination, std::vector<unsigned int> & p_chemin) const;
+
+	size_t m_nbSommets;
+	size_t m_nbRaccourcis;
+	unsigned long m_version;            /*!< version du graphe dont les arcs ont servi à la construction */
+	N m_poidsMax;                       /*!< le plus grand poids d'un arc ou d'un raccourci */
+	std::vector<unsigned int> m_rangs;  /*!< ordre de contraction de chaque sommet */
+	arcsMontants m_avant;               /*!< arcs v -> w avec rang(w) > rang(v), rangés par v */
+	arcsMontants m_arriere;             /*!< arcs u -> v avec rang(u) > rang(v), rangés par v (voisin = u) */
+
+	static const unsigned int AUCUN = std::numeric_limits<unsigned int>::max();
+	static const unsigned int LIMITE_TEMOIN = 500; /*!< nombre maximal de sommets solutionnés par recherche de témoin */
+};
+
+
+#include "HierarchieContraction.hpp"
+
+#endif
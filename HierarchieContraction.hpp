@@ -0,0 +1,531 @@
+//
+//  HierarchieContraction.hpp
+//  hiérarchie de contraction (contraction hierarchies) pour les requêtes de plus court chemin répétées
+//
+
+#include <queue>
+#include <functional>
+#include <algorithm>
+
+#include "HierarchieContraction.h"
+
+template<typename N>
+const unsigned int HierarchieContraction<N>::AUCUN;
+
+template<typename N>
+const unsigned int HierarchieContraction<N>::LIMITE_TEMOIN;
+
+//! \brief		Constructeur sans paramètre
+//! \post		Une hiérarchie vide est créée; construire() doit être appelé avant toute requête
+template<typename N>
+HierarchieContraction<N>::HierarchieContraction() : m_nbSommets(0), m_nbRaccourcis(0), m_version(0), m_poidsMax(0)
+{
+}
+
+//! \brief		Ajoute l'arc vers p_voisin à la liste, ou diminue son poids s'il existe déjà avec un poids plus grand
+template<typename N>
+void HierarchieContraction<N>::ajouterOuRaccourcir(std::vector<arcCH> & p_liste, unsigned int p_voisin,
+		N p_poids, unsigned int p_milieu)
+{
+	for (typename std::vector<arcCH>::iterator itr = p_liste.begin(); itr != p_liste.end(); ++itr)
+	{
+		if (itr->voisin == p_voisin)
+		{
+			if (p_poids < itr->poids)
+			{
+				itr->poids = p_poids;
+				itr->milieu = p_milieu;
+			}
+			return;
+		}
+	}
+	p_liste.push_back(arcCH(p_voisin, p_poids, p_milieu));
+}
+
+//! \brief		Retire l'arc vers p_voisin de la liste
+template<typename N>
+void HierarchieContraction<N>::retirer(std::vector<arcCH> & p_liste, unsigned int p_voisin)
+{
+	for (typename std::vector<arcCH>::iterator itr = p_liste.begin(); itr != p_liste.end(); ++itr)
+	{
+		if (itr->voisin == p_voisin)
+		{
+			*itr = p_liste.back();
+			p_liste.pop_back();
+			return;
+		}
+	}
+}
+
+//! \brief		Range des listes d'arcs par sommet en format CSR
+template<typename N>
+void HierarchieContraction<N>::ranger(size_t p_nbSommets, const listeArcs & p_listes, arcsMontants & p_arcs)
+{
+	p_arcs.debuts.assign(p_nbSommets + 1, 0);
+	p_arcs.voisins.clear();
+	p_arcs.poids.clear();
+	p_arcs.milieux.clear();
+	for (unsigned int v = 0; v < p_nbSommets; ++v)
+	{
+		for (typename std::vector<arcCH>::const_iterator itr = p_listes[v].begin(); itr != p_listes[v].end(); ++itr)
+		{
+			p_arcs.voisins.push_back(itr->voisin);
+			p_arcs.poids.push_back(itr->poids);
+			p_arcs.milieux.push_back(itr->milieu);
+		}
+		p_arcs.debuts[v + 1] = p_arcs.voisins.size();
+	}
+}
+
+//! \brief		Détermine les raccourcis nécessaires pour contracter p_sommet
+//! \brief		pour chaque voisin entrant u, une recherche de témoin locale (limitée à LIMITE_TEMOIN sommets
+//! \brief		solutionnés) cherche un chemin u -> w évitant p_sommet au plus aussi court que u -> p_sommet -> w
+//! \param[out]	p_raccourcis si non nul, reçoit les raccourcis u -> w à ajouter
+//! \return		le nombre de raccourcis nécessaires
+template<typename N>
+unsigned int HierarchieContraction<N>::simulerContraction(unsigned int p_sommet, const listeArcs & p_sortants,
+		const listeArcs & p_entrants, const std::vector<bool> & p_estContracte, ContexteRecherche<N> & p_contexte,
+		std::vector<typename GrapheCSR<N>::arc> * p_raccourcis) const
+{
+	const std::vector<arcCH> & sortants = p_sortants[p_sommet];
+	const std::vector<arcCH> & entrants = p_entrants[p_sommet];
+	unsigned int nbRaccourcis = 0;
+
+	for (typename std::vector<arcCH>::const_iterator entrant = entrants.begin(); entrant != entrants.end(); ++entrant)
+	{
+		const unsigned int u = entrant->voisin;
+		N maxCible = 0;
+		bool aCible = false;
+		for (typename std::vector<arcCH>::const_iterator sortant = sortants.begin(); sortant != sortants.end(); ++sortant)
+		{
+			if (sortant->voisin != u && maxCible < entrant->poids + sortant->poids)
+				maxCible = entrant->poids + sortant->poids;
+			aCible = aCible || sortant->voisin != u;
+		}
+		if (!aCible)
+			continue;
+
+		//recherche de témoin depuis u parmi les sommets non contractés, sans passer par p_sommet
+		p_contexte.preparer(m_nbSommets, 0);
+		p_contexte.fixer(u, 0, AUCUN);
+		TasDAire<N> & file = p_contexte.reqFile();
+		file.insererOuDiminuer(u, 0);
+		for (unsigned int nbSolutionnes = 0; !file.estVide() && nbSolutionnes < LIMITE_TEMOIN; ++nbSolutionnes)
+		{
+			N distance;
+			unsigned int x = file.extraireMin(distance);
+			if (maxCible < distance)
+				break;
+			for (typename std::vector<arcCH>::const_iterator arc = p_sortants[x].begin(); arc != p_sortants[x].end(); ++arc)
+			{
+				if (arc->voisin == p_sommet || p_estContracte[arc->voisin])
+					continue;
+				N poidsTotal = distance + arc->poids;
+				if (poidsTotal < p_contexte.reqDistance(arc->voisin))
+				{
+					p_contexte.fixer(arc->voisin, poidsTotal, x);
+					file.insererOuDiminuer(arc->voisin, poidsTotal);
+				}
+			}
+		}
+
+		for (typename std::vector<arcCH>::const_iterator sortant = sortants.begin(); sortant != sortants.end(); ++sortant)
+		{
+			if (sortant->voisin == u)
+				continue;
+			N parSommet = entrant->poids + sortant->poids;
+			if (parSommet < p_contexte.reqDistance(sortant->voisin))
+			{
+				++nbRaccourcis;
+				if (p_raccourcis != 0)
+					p_raccourcis->push_back(typename GrapheCSR<N>::arc(u, sortant->voisin, parSommet));
+			}
+		}
+	}
+	return nbRaccourcis;
+}
+
+//! \brief		Priorité de contraction: différence d'arcs (raccourcis ajoutés - arcs retirés)
+//! \brief		plus le nombre de voisins déjà contractés, pour répartir les contractions dans le graphe
+template<typename N>
+int HierarchieContraction<N>::priorite(unsigned int p_sommet, const listeArcs & p_sortants, const listeArcs & p_entrants,
+		const std::vector<bool> & p_estContracte, const std::vector<unsigned int> & p_nbVoisinsContractes,
+		ContexteRecherche<N> & p_contexte) const
+{
+	int nbRaccourcis = simulerContraction(p_sommet, p_sortants, p_entrants, p_estContracte, p_contexte, 0);
+	return nbRaccourcis - (int) (p_sortants[p_sommet].size() + p_entrants[p_sommet].size())
+			+ (int) p_nbVoisinsContractes[p_sommet];
+}
+
+//! \brief		Construit la hiérarchie à partir des arcs d'un graphe figé
+//! \brief		les sommets sont contractés par priorité croissante, avec mise à jour paresseuse: la priorité
+//! \brief		du sommet retiré de la file est recalculée et il y est remis si elle n'est plus minimale
+//! \param[in]	p_arcs les arcs du graphe
+//! \param[in]	p_version la version du graphe dont viennent les arcs (Graphe::reqVersion())
+//! \post		chaque sommet a un rang et les arcs montants (arcs et raccourcis) sont rangés en format CSR
+template<typename N>
+void HierarchieContraction<N>::construire(const GrapheCSR<N> & p_arcs, unsigned long p_version)
+{
+	m_nbSommets = p_arcs.reqNbSommets();
+	m_version = p_version;
+	listeArcs sortants(m_nbSommets);
+	listeArcs entrants(m_nbSommets);
+	for (unsigned int i = 0; i < m_nbSommets; ++i)
+	{
+		for (unsigned int k = p_arcs.reqDebut(i); k < p_arcs.reqFin(i); ++k)
+		{
+			unsigned int j = p_arcs.reqDestination(k);
+			if (j == i)
+				continue;
+			ajouterOuRaccourcir(sortants[i], j, p_arcs.reqPoids(k), AUCUN);
+			ajouterOuRaccourcir(entrants[j], i, p_arcs.reqPoids(k), AUCUN);
+		}
+	}
+
+	std::vector<bool> estContracte(m_nbSommets, false);
+	std::vector<unsigned int> nbVoisinsContractes(m_nbSommets, 0);
+	listeArcs montantsAvant(m_nbSommets);
+	listeArcs montantsArriere(m_nbSommets);
+	ContexteRecherche<N> contexte;
+	std::vector<typename GrapheCSR<N>::arc> raccourcis;
+
+	typedef std::pair<int, unsigned int> element;
+	std::priority_queue< element, std::vector<element>, std::greater<element> > file;
+	for (unsigned int v = 0; v < m_nbSommets; ++v)
+		file.push(element(priorite(v, sortants, entrants, estContracte, nbVoisinsContractes, contexte), v));
+
+	m_rangs.assign(m_nbSommets, 0);
+	unsigned int rang = 0;
+	while (!file.empty())
+	{
+		unsigned int v = file.top().second;
+		file.pop();
+		int prioriteCourante = priorite(v, sortants, entrants, estContracte, nbVoisinsContractes, contexte);
+		if (!file.empty() && file.top().first < prioriteCourante)
+		{
+			file.push(element(prioriteCourante, v));
+			continue;
+		}
+
+		raccourcis.clear();
+		simulerContraction(v, sortants, entrants, estContracte, contexte, &raccourcis);
+
+		m_rangs[v] = rang++;
+		estContracte[v] = true;
+		montantsAvant[v] = sortants[v];
+		montantsArriere[v] = entrants[v];
+		for (typename std::vector<arcCH>::const_iterator itr = sortants[v].begin(); itr != sortants[v].end(); ++itr)
+		{
+			retirer(entrants[itr->voisin], v);
+			++nbVoisinsContractes[itr->voisin];
+		}
+		for (typename std::vector<arcCH>::const_iterator itr = entrants[v].begin(); itr != entrants[v].end(); ++itr)
+		{
+			retirer(sortants[itr->voisin], v);
+			++nbVoisinsContractes[itr->voisin];
+		}
+		for (typename std::vector<typename GrapheCSR<N>::arc>::const_iterator itr = raccourcis.begin(); itr != raccourcis.end(); ++itr)
+		{
+			ajouterOuRaccourcir(sortants[itr->origine], itr->destination, itr->poids, v);
+			ajouterOuRaccourcir(entrants[itr->destination], itr->origine, itr->poids, v);
+		}
+		std::vector<arcCH>().swap(sortants[v]);
+		std::vector<arcCH>().swap(entrants[v]);
+	}
+
+	ranger(m_nbSommets, montantsAvant, m_avant);
+	ranger(m_nbSommets, montantsArriere, m_arriere);
+
+	m_nbRaccourcis = 0;
+	m_poidsMax = 0;
+	for (unsigned int k = 0; k < m_avant.voisins.size(); ++k)
+	{
+		m_nbRaccourcis += m_avant.milieux[k] != AUCUN;
+		m_poidsMax = std::max(m_poidsMax, m_avant.poids[k]);
+	}
+	for (unsigned int k = 0; k < m_arriere.voisins.size(); ++k)
+	{
+		m_nbRaccourcis += m_arriere.milieux[k] != AUCUN;
+		m_poidsMax = std::max(m_poidsMax, m_arriere.poids[k]);
+	}
+}
+
+template<typename N>
+size_t HierarchieContraction<N>::reqNbSommets() const
+{
+	return m_nbSommets;
+}
+
+//! \brief		Obtient le nombre de raccourcis conservés dans la hiérarchie
+template<typename N>
+size_t HierarchieContraction<N>::reqNbRaccourcis() const
+{
+	return m_nbRaccourcis;
+}
+
+//! \brief		Obtient le rang (ordre de contraction) d'un sommet
+template<typename N>
+unsigned int HierarchieContraction<N>::reqRang(unsigned int p_sommet) const
+{
+	PRECONDITION(p_sommet < m_nbSommets);
+	return m_rangs[p_sommet];
+}
+
+//! \brief		Obtient la version du graphe pour laquelle la hiérarchie a été construite
+template<typename N>
+unsigned long HierarchieContraction<N>::reqVersion() const
+{
+	return m_version;
+}
+
+//! \brief		Obtient le sommet court-circuité par l'arc p_origine -> p_destination de la hiérarchie
+//! \return		AUCUN si c'est un arc du graphe d'origine
+template<typename N>
+unsigned int HierarchieContraction<N>::trouverMilieu(unsigned int p_origine, unsigned int p_destination) const
+{
+	const arcsMontants & arcs = m_rangs[p_origine] < m_rangs[p_destination] ? m_avant : m_arriere;
+	const unsigned int sommet = m_rangs[p_origine] < m_rangs[p_destination] ? p_origine : p_destination;
+	const unsigned int voisin = m_rangs[p_origine] < m_rangs[p_destination] ? p_destination : p_origine;
+	for (unsigned int k = arcs.debuts[sommet]; k < arcs.debuts[sommet + 1]; ++k)
+		if (arcs.voisins[k] == voisin)
+			return arcs.milieux[k];
+	throw std::logic_error("HierarchieContraction::trouverMilieu(): arc absent de la hiérarchie");
+}
+
+//! \brief		Ajoute au chemin les sommets de l'arc p_origine -> p_destination déplié récursivement,
+//! \brief		p_origine exclu et p_destination inclus
+template<typename N>
+void HierarchieContraction<N>::deplier(unsigned int p_origine, unsigned int p_destination,
+		std::vector<unsigned int> & p_chemin) const
+{
+	unsigned int milieu = trouverMilieu(p_origine, p_destination);
+	if (milieu == AUCUN)
+	{
+		p_chemin.push_back(p_destination);
+		return;
+	}
+	deplier(p_origine, milieu, p_chemin);
+	deplier(milieu, p_destination, p_chemin);
+}
+
+//! \brief		Requête de plus court chemin dans la hiérarchie
+//! \brief		une recherche avant depuis p_origine et une recherche arrière depuis p_destination ne suivent
+//! \brief		que des arcs montants; elles solutionnent un sommet à tour de rôle, et chacune s'arrête quand
+//! \brief		sa plus petite clé atteint la meilleure longueur trouvée. Un sommet atteint plus court par un
+//! \brief		arc descendant depuis un sommet plus haut n'est pas relâché (stall-on-demand).
+//! \param[out]	p_chemin les sommets du plus court chemin dans le graphe d'origine (raccourcis dépliés)
+//! \param[in,out] p_contexteAvant l'espace de travail de la recherche avant
+//! \param[in,out] p_contexteArriere l'espace de travail de la recherche arrière
+//! \return		la longueur du chemin (= numeric_limits<N>::max() si p_destination n'est pas atteignable;
+//!				p_chemin ne contient alors que p_destination)
+template<typename N>
+template<typename FilePriorite>
+N HierarchieContraction<N>::requete(unsigned int p_origine, unsigned int p_destination,
+		std::vector<unsigned int> & p_chemin,
+		ContexteRecherche<N, FilePriorite> & p_contexteAvant,
+		ContexteRecherche<N, FilePriorite> & p_contexteArriere) const
+{
+	PRECONDITION(p_origine < m_nbSommets && p_destination < m_nbSommets);
+
+	p_contexteAvant.preparer(m_nbSommets, m_poidsMax);
+	p_contexteArriere.preparer(m_nbSommets, m_poidsMax);
+	p_contexteAvant.fixer(p_origine, 0, AUCUN);
+	p_contexteArriere.fixer(p_destination, 0, AUCUN);
+	p_contexteAvant.reqFile().insererOuDiminuer(p_origine, 0);
+	p_contexteArriere.reqFile().insererOuDiminuer(p_destination, 0);
+
+	N meilleure = std::numeric_limits<N>::max();
+	unsigned int sommetRencontre = AUCUN;
+	bool sensAvant = true;
+	while (!p_contexteAvant.reqFile().estVide() || !p_contexteArriere.reqFile().estVide())
+	{
+		if ((sensAvant ? p_contexteAvant : p_contexteArriere).reqFile().estVide())
+			sensAvant = !sensAvant;
+		ContexteRecherche<N, FilePriorite> & contexte = sensAvant ? p_contexteAvant : p_contexteArriere;
+		const ContexteRecherche<N, FilePriorite> & contexteOppose = sensAvant ? p_contexteArriere : p_contexteAvant;
+		const arcsMontants & montants = sensAvant ? m_avant : m_arriere;
+		const arcsMontants & descendants = sensAvant ? m_arriere : m_avant;
+		sensAvant = !sensAvant;
+
+		N distance;
+		unsigned int sommet = contexte.reqFile().extraireMin(distance);
+		if (!(distance < meilleure))
+		{
+			contexte.reqFile().vider(); //cette direction ne peut plus améliorer la meilleure longueur
+			continue;
+		}
+
+		//stall-on-demand: un arc venant d'un sommet plus haut donne-t-il une distance plus courte?
+		bool estBloque = false;
+		for (unsigned int k = descendants.debuts[sommet]; !estBloque && k < descendants.debuts[sommet + 1]; ++k)
+		{
+			unsigned int plusHaut = descendants.voisins[k];
+			estBloque = contexte.estAtteint(plusHaut) && contexte.reqDistance(plusHaut) + descendants.poids[k] < distance;
+		}
+		if (estBloque)
+			continue;
+
+		if (contexteOppose.estAtteint(sommet) && distance + contexteOppose.reqDistance(sommet) < meilleure)
+		{
+			meilleure = distance + contexteOppose.reqDistance(sommet);
+			sommetRencontre = sommet;
+		}
+
+		for (unsigned int k = montants.debuts[sommet]; k < montants.debuts[sommet + 1]; ++k)
+		{
+			unsigned int unVoisin = montants.voisins[k];
+			N poidsTotalVoisin = distance + montants.poids[k];
+			if (poidsTotalVoisin < contexte.reqDistance(unVoisin))
+			{
+				contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				contexte.reqFile().insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+		}
+	}
+
+	p_chemin.clear();
+	if (sommetRencontre == AUCUN)
+	{
+		p_chemin.push_back(p_destination);
+		return std::numeric_limits<N>::max();
+	}
+
+	//partie avant: les sommets montants de p_origine à sommetRencontre, puis chaque arc déplié
+	std::vector<unsigned int> sommetsMontants;
+	for (unsigned int sommet = sommetRencontre; sommet != AUCUN; sommet = p_contexteAvant.reqPredecesseur(sommet))
+		sommetsMontants.push_back(sommet);
+	p_chemin.push_back(p_origine);
+	for (size_t i = sommetsMontants.size() - 1; i > 0; --i)
+		deplier(sommetsMontants[i], sommetsMontants[i - 1], p_chemin);
+
+	//partie arrière: de sommetRencontre à p_destination
+	for (unsigned int sommet = sommetRencontre, suivant = p_contexteArriere.reqPredecesseur(sommet);
+			suivant != AUCUN; sommet = suivant, suivant = p_contexteArriere.reqPredecesseur(sommet))
+		deplier(sommet, suivant, p_chemin);
+
+	return meilleure;
+}
+
+//! \brief		Recherche montante complète depuis p_source, avec stall-on-demand
+//! \param[in]	p_montants les arcs suivis (m_avant pour une recherche avant, m_arriere pour une recherche arrière)
+//! \param[in]	p_descendants les arcs de sens opposé, qui servent à détecter les sommets bloqués
+//! \param[out]	p_atteints les sommets solutionnés non bloqués et leur distance (le contenu précédent est effacé)
+template<typename N>
+template<typename FilePriorite>
+void HierarchieContraction<N>::explorerMontant(unsigned int p_source, const arcsMontants & p_montants,
+		const arcsMontants & p_descendants, ContexteRecherche<N, FilePriorite> & p_contexte,
+		std::vector< std::pair<unsigned int, N> > & p_atteints) const
+{
+	p_atteints.clear();
+	p_contexte.preparer(m_nbSommets, m_poidsMax);
+	p_contexte.fixer(p_source, 0, AUCUN);
+	FilePriorite & file = p_contexte.reqFile();
+	file.insererOuDiminuer(p_source, 0);
+
+	while (!file.estVide())
+	{
+		N distance;
+		unsigned int sommet = file.extraireMin(distance);
+
+		bool estBloque = false;
+		for (unsigned int k = p_descendants.debuts[sommet]; !estBloque && k < p_descendants.debuts[sommet + 1]; ++k)
+		{
+			unsigned int plusHaut = p_descendants.voisins[k];
+			estBloque = p_contexte.estAtteint(plusHaut) && p_contexte.reqDistance(plusHaut) + p_descendants.poids[k] < distance;
+		}
+		if (estBloque)
+			continue;
+
+		p_atteints.push_back(std::make_pair(sommet, distance));
+		for (unsigned int k = p_montants.debuts[sommet]; k < p_montants.debuts[sommet + 1]; ++k)
+		{
+			unsigned int unVoisin = p_montants.voisins[k];
+			N poidsTotalVoisin = distance + p_montants.poids[k];
+			if (poidsTotalVoisin < p_contexte.reqDistance(unVoisin))
+			{
+				p_contexte.fixer(unVoisin, poidsTotalVoisin, sommet);
+				file.insererOuDiminuer(unVoisin, poidsTotalVoisin);
+			}
+		}
+	}
+}
+
+//! \brief		Matrice des distances de plusieurs origines vers plusieurs destinations, par seaux
+//! \brief		une recherche arrière montante par destination dépose (destination, distance) dans le seau
+//! \brief		de chaque sommet atteint; une recherche avant montante par origine parcourt ensuite les seaux
+//! \brief		des sommets qu'elle atteint. Le plus court chemin passe par son sommet de plus haut rang,
+//! \brief		atteint par les deux recherches: le minimum sur les seaux est donc la distance exacte.
+//! \brief		Les deux phases se partagent entre les fils du bassin (destinations, puis origines).
+//! \param[in]	p_origines les origines (une rangée par origine)
+//! \param[in]	p_destinations les destinations (une colonne par destination)
+//! \param[out]	p_matrice au moins |origines| x |destinations| cases, par rangée;
+//! \param[out]	numeric_limits<N>::max() pour une destination non atteignable
+//! \param[in]	p_bassin le bassin de fils d'exécution
+template<typename N>
+template<typename FilePriorite>
+void HierarchieContraction<N>::matriceDistances(const std::vector<unsigned int> & p_origines,
+		const std::vector<unsigned int> & p_destinations, N * p_matrice, BassinFils & p_bassin) const
+{
+	const size_t nbDestinations = p_destinations.size();
+	std::fill(p_matrice, p_matrice + p_origines.size() * nbDestinations, std::numeric_limits<N>::max());
+
+	std::vector< ContexteRecherche<N, FilePriorite> > contextes(p_bassin.reqNbFils());
+	std::vector< std::vector< std::pair<unsigned int, N> > > atteints(p_bassin.reqNbFils());
+
+	//phase 1: seaux, collectés par fil puis rangés par sommet (format CSR)
+	struct entreeSeau
+	{
+		unsigned int sommet;
+		unsigned int destination;
+		N distance;
+	};
+	std::vector< std::vector<entreeSeau> > entrees(p_bassin.reqNbFils());
+	p_bassin.executer(nbDestinations, [&](unsigned int p_destination, unsigned int p_fil)
+	{
+		PRECONDITION(p_destinations[p_destination] < m_nbSommets);
+		explorerMontant(p_destinations[p_destination], m_arriere, m_avant, contextes[p_fil], atteints[p_fil]);
+		for (size_t i = 0; i < atteints[p_fil].size(); ++i)
+		{
+			entreeSeau entree = { atteints[p_fil][i].first, p_destination, atteints[p_fil][i].second };
+			entrees[p_fil].push_back(entree);
+		}
+	});
+
+	std::vector<unsigned int> debuts(m_nbSommets + 1, 0);
+	for (size_t f = 0; f < entrees.size(); ++f)
+		for (size_t i = 0; i < entrees[f].size(); ++i)
+			++debuts[entrees[f][i].sommet + 1];
+	for (size_t v = 0; v < m_nbSommets; ++v)
+		debuts[v + 1] += debuts[v];
+	std::vector<unsigned int> seauDestinations(debuts[m_nbSommets]);
+	std::vector<N> seauDistances(debuts[m_nbSommets]);
+	std::vector<unsigned int> prochain(debuts.begin(), debuts.end() - 1);
+	for (size_t f = 0; f < entrees.size(); ++f)
+	{
+		for (size_t i = 0; i < entrees[f].size(); ++i)
+		{
+			unsigned int k = prochain[entrees[f][i].sommet]++;
+			seauDestinations[k] = entrees[f][i].destination;
+			seauDistances[k] = entrees[f][i].distance;
+		}
+		std::vector<entreeSeau>().swap(entrees[f]);
+	}
+
+	//phase 2: chaque origine remplit sa propre rangée
+	p_bassin.executer(p_origines.size(), [&](unsigned int p_origine, unsigned int p_fil)
+	{
+		PRECONDITION(p_origines[p_origine] < m_nbSommets);
+		explorerMontant(p_origines[p_origine], m_avant, m_arriere, contextes[p_fil], atteints[p_fil]);
+		N * rangee = p_matrice + p_origine * nbDestinations;
+		for (size_t i = 0; i < atteints[p_fil].size(); ++i)
+		{
+			unsigned int sommet = atteints[p_fil][i].first;
+			for (unsigned int k = debuts[sommet]; k < debuts[sommet + 1]; ++k)
+			{
+				N candidat = atteints[p_fil][i].second + seauDistances[k];
+				if (candidat < rangee[seauDestinations[k]])
+					rangee[seauDestinations[k]] = candidat;
+			}
+		}
+	});
+}
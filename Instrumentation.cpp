@@ -0,0 +1,249 @@
+/**
+ * \file   Instrumentation.cpp
+ * \brief  Fichier contenant l'implémentation de la classe Instrumentation
+ */
+
+#include "Instrumentation.h"
+
+#include <mutex>
+#include <cstring>
+#include <algorithm>
+
+using namespace std;
+
+thread_local Instrumentation::donneesFil * Instrumentation::t_fil = 0;
+vector<Instrumentation::donneesFil *> Instrumentation::s_fils;
+
+namespace {
+mutex g_verrou;
+const Instrumentation::horloge::time_point g_origine = Instrumentation::horloge::now();
+
+/** \brief écrit un nom entre guillemets, en échappant ce que JSON exige */
+void ecrireChaine(ostream & p_sortie, const char * p_texte) {
+	p_sortie << '"';
+	for (; *p_texte; ++p_texte) {
+		if (*p_texte == '"' || *p_texte == '\\')
+			p_sortie << '\\';
+		p_sortie << *p_texte;
+	}
+	p_sortie << '"';
+}
+}
+
+/**
+ * \brief Constructeur: tous les compteurs à zéro
+ */
+CompteursRecherche::CompteursRecherche() :
+		solutionnes(0), relaches(0), insertions(0), diminutions(0), frontiereMax(0) {
+}
+
+/**
+ * \brief Additionne d'autres compteurs à ceux-ci (frontiereMax prend le maximum)
+ */
+void CompteursRecherche::ajouter(const CompteursRecherche & p_autres) {
+	solutionnes += p_autres.solutionnes;
+	relaches += p_autres.relaches;
+	insertions += p_autres.insertions;
+	diminutions += p_autres.diminutions;
+	frontiereMax = max(frontiereMax, p_autres.frontiereMax);
+}
+
+/**
+ * \brief Indique si le programme a été compilé avec -DINSTRUMENTATION
+ * \note sinon, les résultats écrits sont vides
+ */
+bool Instrumentation::estCompilee() {
+#if defined(INSTRUMENTATION)
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+ * \brief Crée et inscrit les données du fil courant, au premier événement de ce fil
+ */
+Instrumentation::donneesFil * Instrumentation::nouveauFil() {
+	lock_guard<mutex> verrou(g_verrou);
+	donneesFil * fil = new donneesFil();
+	fil->numero = s_fils.size();
+	fil->frontiere = 0;
+	fil->frontiereMaxRequete = 0;
+	s_fils.push_back(fil);
+	return fil;
+}
+
+/**
+ * \brief Microsecondes écoulées entre le lancement du programme et p_instant
+ */
+double Instrumentation::depuisOrigine(horloge::time_point p_instant) {
+	return chrono::duration<double, micro>(p_instant - g_origine).count();
+}
+
+/**
+ * \brief Somme des compteurs de tous les fils
+ */
+CompteursRecherche Instrumentation::reqTotaux() {
+	lock_guard<mutex> verrou(g_verrou);
+	CompteursRecherche totaux;
+	for (size_t f = 0; f < s_fils.size(); ++f)
+		totaux.ajouter(s_fils[f]->compteurs);
+	return totaux;
+}
+
+/**
+ * \brief Écrit les compteurs totaux, puis le nombre d'appels et la durée de chaque phase, tous fils confondus
+ */
+void Instrumentation::ecrireResume(ostream & p_sortie) {
+	CompteursRecherche totaux = reqTotaux();
+	p_sortie << "sommets solutionnés: " << totaux.solutionnes << "\n"
+			<< "arcs relâchés: " << totaux.relaches << "\n"
+			<< "insertions: " << totaux.insertions << ", diminutions: " << totaux.diminutions << "\n"
+			<< "frontière maximale: " << totaux.frontiereMax << " sommets\n";
+
+	lock_guard<mutex> verrou(g_verrou);
+	vector<totalPhase> phases;
+	for (size_t f = 0; f < s_fils.size(); ++f) {
+		const donneesFil & fil = *s_fils[f];
+		for (size_t p = 0; p < fil.phases.size(); ++p) {
+			size_t i = 0;
+			while (i < phases.size() && strcmp(phases[i].nom, fil.phases[p].nom) != 0)
+				++i;
+			if (i == phases.size())
+				phases.push_back(totalPhase { fil.phases[p].nom, 0, 0 });
+			phases[i].nbAppels += fil.phases[p].nbAppels;
+			phases[i].duree += fil.phases[p].duree;
+		}
+	}
+	for (size_t i = 0; i < phases.size(); ++i)
+		p_sortie << "phase " << phases[i].nom << ": " << phases[i].nbAppels << " appel(s), "
+				<< phases[i].duree << " us au total, " << phases[i].duree / phases[i].nbAppels << " us par appel\n";
+}
+
+/**
+ * \brief Écrit une ligne CSV par requête mesurée: nom, fil, début et durée (microsecondes), compteurs
+ */
+void Instrumentation::ecrireRequetes(ostream & p_sortie) {
+	lock_guard<mutex> verrou(g_verrou);
+	p_sortie << "requete,fil,debut_us,duree_us,solutionnes,relaches,insertions,diminutions,frontiere_max\n";
+	for (size_t f = 0; f < s_fils.size(); ++f) {
+		const donneesFil & fil = *s_fils[f];
+		for (size_t e = 0; e < fil.evenements.size(); ++e) {
+			const evenement & ev = fil.evenements[e];
+			if (!ev.estRequete)
+				continue;
+			p_sortie << ev.nom << ',' << fil.numero << ',' << ev.debut << ',' << ev.duree << ','
+					<< ev.compteurs.solutionnes << ',' << ev.compteurs.relaches << ',' << ev.compteurs.insertions << ','
+					<< ev.compteurs.diminutions << ',' << ev.compteurs.frontiereMax << '\n';
+		}
+	}
+}
+
+/**
+ * \brief Écrit les requêtes et les phases au format trace_event de Chrome (événements complets "X",
+ *        un fil de la trace par fil d'exécution; les compteurs d'une requête sont dans ses "args")
+ */
+void Instrumentation::ecrireTrace(ostream & p_sortie) {
+	lock_guard<mutex> verrou(g_verrou);
+	p_sortie << "{\"traceEvents\":[";
+	bool premier = true;
+	for (size_t f = 0; f < s_fils.size(); ++f) {
+		const donneesFil & fil = *s_fils[f];
+		for (size_t e = 0; e < fil.evenements.size(); ++e) {
+			const evenement & ev = fil.evenements[e];
+			p_sortie << (premier ? "\n" : ",\n") << "{\"name\":";
+			ecrireChaine(p_sortie, ev.nom);
+			p_sortie << ",\"cat\":\"" << (ev.estRequete ? "requete" : "phase") << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+					<< fil.numero << ",\"ts\":" << ev.debut << ",\"dur\":" << ev.duree;
+			if (ev.estRequete)
+				p_sortie << ",\"args\":{\"solutionnes\":" << ev.compteurs.solutionnes << ",\"relaches\":"
+						<< ev.compteurs.relaches << ",\"insertions\":" << ev.compteurs.insertions << ",\"diminutions\":"
+						<< ev.compteurs.diminutions << ",\"frontiere_max\":" << ev.compteurs.frontiereMax << "}";
+			p_sortie << "}";
+			premier = false;
+		}
+	}
+	p_sortie << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+/**
+ * \brief Remet à zéro les compteurs, les phases et les événements de tous les fils
+ */
+void Instrumentation::vider() {
+	lock_guard<mutex> verrou(g_verrou);
+	for (size_t f = 0; f < s_fils.size(); ++f) {
+		donneesFil & fil = *s_fils[f];
+		fil.compteurs = CompteursRecherche();
+		fil.frontiere = 0;
+		fil.frontiereMaxRequete = 0;
+		fil.evenements.clear();
+		fil.phases.clear();
+	}
+}
+
+/**
+ * \brief Ajoute la durée d'une phase terminée aux totaux du fil, et à ses événements s'il en reste la place
+ */
+void Instrumentation::terminerPhase(const char * p_nom, horloge::time_point p_debut) {
+	horloge::time_point fin = horloge::now();
+	donneesFil & fil = reqFil();
+	const double duree = chrono::duration<double, micro>(fin - p_debut).count();
+
+	size_t i = 0;
+	while (i < fil.phases.size() && fil.phases[i].nom != p_nom && strcmp(fil.phases[i].nom, p_nom) != 0)
+		++i;
+	if (i == fil.phases.size())
+		fil.phases.push_back(totalPhase { p_nom, 0, 0 });
+	++fil.phases[i].nbAppels;
+	fil.phases[i].duree += duree;
+
+	if (fil.evenements.size() < LIMITE_EVENEMENTS)
+		fil.evenements.push_back(evenement { p_nom, depuisOrigine(p_debut), duree, false, CompteursRecherche() });
+}
+
+/**
+ * \brief Début d'une requête: la frontière est remise à zéro et les compteurs du fil sont notés
+ */
+Instrumentation::Requete::Requete(const char * p_nom) :
+		m_nom(p_nom) {
+	donneesFil & fil = reqFil();
+	fil.frontiere = 0;
+	fil.frontiereMaxRequete = 0;
+	m_auDebut = fil.compteurs;
+	m_debut = horloge::now();
+}
+
+/**
+ * \brief Fin d'une requête: ses compteurs sont ceux du fil moins ceux du début
+ */
+Instrumentation::Requete::~Requete() {
+	horloge::time_point fin = horloge::now();
+	donneesFil & fil = reqFil();
+	CompteursRecherche compteurs;
+	compteurs.solutionnes = fil.compteurs.solutionnes - m_auDebut.solutionnes;
+	compteurs.relaches = fil.compteurs.relaches - m_auDebut.relaches;
+	compteurs.insertions = fil.compteurs.insertions - m_auDebut.insertions;
+	compteurs.diminutions = fil.compteurs.diminutions - m_auDebut.diminutions;
+	compteurs.frontiereMax = fil.frontiereMaxRequete;
+	fil.compteurs.frontiereMax = max(fil.compteurs.frontiereMax, fil.frontiereMaxRequete);
+	if (fil.evenements.size() < LIMITE_EVENEMENTS)
+		fil.evenements.push_back(evenement { m_nom, depuisOrigine(m_debut),
+				chrono::duration<double, micro>(fin - m_debut).count(), true, compteurs });
+}
+
+Instrumentation::Phase::Phase(const char * p_nom) :
+		m_nom(p_nom), m_debut(horloge::now()) {
+}
+
+Instrumentation::Phase::~Phase() {
+	terminerPhase(m_nom, m_debut);
+}
+
+/**
+ * \brief Termine la phase en cours et commence la phase p_nom
+ */
+void Instrumentation::Phase::enchainer(const char * p_nom) {
+	terminerPhase(m_nom, m_debut);
+	m_nom = p_nom;
+	m_debut = horloge::now();
+}
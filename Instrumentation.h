@@ -0,0 +1,196 @@
+/**
+ * \file   Instrumentation.h
+ * \brief  Fichier contenant la déclaration de la classe Instrumentation (compteurs et chronométrage des recherches)
+ *
+ * L'instrumentation n'est compilée qu'avec -DINSTRUMENTATION. Sans ce drapeau, les macros INSTRUMENTER_...
+ * ne produisent aucun code et leurs arguments ne sont pas évalués, comme PRECONDITION avec NDEBUG: les boucles
+ * de recherche sont alors exactement celles d'un programme sans instrumentation.
+ *
+ * Avec le drapeau, chaque fil d'exécution accumule ses propres compteurs (sommets solutionnés, arcs relâchés,
+ * insertions et diminutions dans la file, taille maximale de la frontière), les durées de ses phases et une
+ * ligne par requête, sans verrou. Les résultats de tous les fils sont réunis par ecrireResume(), ecrireRequetes()
+ * (CSV) et ecrireTrace() (format trace_event de Chrome, à ouvrir dans chrome://tracing ou Perfetto).
+ *
+ * Usage dans une fonction de recherche:
+ *   INSTRUMENTER_REQUETE("dijkstraV2");        // une ligne de statistiques pour tout l'appel
+ *   INSTRUMENTER_PHASE(phase, "dijkstraV2: recherche"); // chronomètre jusqu'à la phase suivante ou la fin du bloc
+ *   ...
+ *   INSTRUMENTER_ENCHAINER(phase, "dijkstraV2: chemin");
+ */
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+
+/**
+ * \struct CompteursRecherche
+ * \brief Compteurs d'une requête, d'un fil ou de tout le programme
+ */
+struct CompteursRecherche
+{
+	unsigned long long solutionnes;   /*!< sommets extraits de la file */
+	unsigned long long relaches;      /*!< arcs examinés depuis un sommet solutionné */
+	unsigned long long insertions;    /*!< sommets atteints pour la première fois */
+	unsigned long long diminutions;   /*!< distances diminuées d'un sommet déjà dans la file */
+	unsigned long long frontiereMax;  /*!< nombre maximal de sommets atteints mais non solutionnés */
+
+	CompteursRecherche();
+	void ajouter(const CompteursRecherche & p_autres);
+};
+
+/**
+ * \class Instrumentation
+ * \brief Accumulation par fil des compteurs et des durées, et écriture des résultats
+ * \note ecrireResume(), ecrireRequetes(), ecrireTrace() et vider() ne doivent pas être appelées
+ *       pendant qu'une recherche instrumentée est en cours dans un autre fil
+ */
+class Instrumentation
+{
+public:
+	typedef std::chrono::steady_clock horloge;
+
+	static bool estCompilee();
+	static CompteursRecherche reqTotaux();
+	static void ecrireResume(std::ostream & p_sortie);
+	static void ecrireRequetes(std::ostream & p_sortie);
+	static void ecrireTrace(std::ostream & p_sortie);
+	static void vider();
+
+	static void solutionne();
+	static void relache();
+	static void amelioration(bool p_estNouveau);
+
+	/**
+	 * \class Requete
+	 * \brief Mesure un appel de recherche: sa durée et ses compteurs, de la construction à la destruction
+	 */
+	class Requete
+	{
+	public:
+		explicit Requete(const char * p_nom);
+		~Requete();
+	private:
+		Requete(const Requete &);
+		Requete & operator=(const Requete &);
+
+		const char * m_nom;
+		horloge::time_point m_debut;
+		CompteursRecherche m_auDebut;
+	};
+
+	/**
+	 * \class Phase
+	 * \brief Chronomètre une phase nommée, jusqu'à enchainer() ou la destruction
+	 */
+	class Phase
+	{
+	public:
+		explicit Phase(const char * p_nom);
+		~Phase();
+		void enchainer(const char * p_nom);
+	private:
+		Phase(const Phase &);
+		Phase & operator=(const Phase &);
+
+		const char * m_nom;
+		horloge::time_point m_debut;
+	};
+
+private:
+	/** \brief une phase ou une requête terminée; les compteurs ne servent qu'aux requêtes */
+	struct evenement
+	{
+		const char * nom;
+		double debut;                 // microsecondes depuis le lancement du programme
+		double duree;                 // microsecondes
+		bool estRequete;
+		CompteursRecherche compteurs;
+	};
+
+	/** \brief durée totale d'une phase dans un fil */
+	struct totalPhase
+	{
+		const char * nom;
+		unsigned long long nbAppels;
+		double duree;                 // microsecondes
+	};
+
+	/** \brief tout ce qu'accumule un fil; seul ce fil y écrit */
+	struct donneesFil
+	{
+		unsigned int numero;
+		CompteursRecherche compteurs;
+		long long frontiere;                      // sommets atteints mais non solutionnés depuis le début de la requête
+		unsigned long long frontiereMaxRequete;
+		std::vector<evenement> evenements;
+		std::vector<totalPhase> phases;
+	};
+
+	static const size_t LIMITE_EVENEMENTS = 1 << 20; /*!< événements gardés par fil; les totaux restent exacts au-delà */
+
+	static donneesFil & reqFil();
+	static donneesFil * nouveauFil();
+	static double depuisOrigine(horloge::time_point p_instant);
+	static void terminerPhase(const char * p_nom, horloge::time_point p_debut);
+
+	static thread_local donneesFil * t_fil;
+	static std::vector<donneesFil *> s_fils; /*!< les données de chaque fil instrumenté, gardées après la fin du fil */
+};
+
+inline Instrumentation::donneesFil & Instrumentation::reqFil() {
+	if (t_fil == 0)
+		t_fil = nouveauFil();
+	return *t_fil;
+}
+
+/**
+ * \brief Compte un sommet extrait de la file
+ */
+inline void Instrumentation::solutionne() {
+	donneesFil & fil = reqFil();
+	++fil.compteurs.solutionnes;
+	--fil.frontiere;
+}
+
+/**
+ * \brief Compte un arc examiné
+ */
+inline void Instrumentation::relache() {
+	++reqFil().compteurs.relaches;
+}
+
+/**
+ * \brief Compte une distance améliorée
+ * \param[in] p_estNouveau vrai si le sommet n'avait pas encore été atteint (insertion), faux sinon (diminution)
+ */
+inline void Instrumentation::amelioration(bool p_estNouveau) {
+	donneesFil & fil = reqFil();
+	if (!p_estNouveau) {
+		++fil.compteurs.diminutions;
+		return;
+	}
+	++fil.compteurs.insertions;
+	if (++fil.frontiere > (long long) fil.frontiereMaxRequete)
+		fil.frontiereMaxRequete = fil.frontiere;
+}
+
+#if defined(INSTRUMENTATION)
+#  define INSTRUMENTER_REQUETE(nom) Instrumentation::Requete requeteInstrumentee(nom)
+#  define INSTRUMENTER_PHASE(variable, nom) Instrumentation::Phase variable(nom)
+#  define INSTRUMENTER_ENCHAINER(variable, nom) variable.enchainer(nom)
+#  define INSTRUMENTER_SOLUTIONNE() Instrumentation::solutionne()
+#  define INSTRUMENTER_RELACHE() Instrumentation::relache()
+#  define INSTRUMENTER_AMELIORATION(estNouveau) Instrumentation::amelioration(estNouveau)
+#else
+#  define INSTRUMENTER_REQUETE(nom)
+#  define INSTRUMENTER_PHASE(variable, nom)
+#  define INSTRUMENTER_ENCHAINER(variable, nom)
+#  define INSTRUMENTER_SOLUTIONNE()
+#  define INSTRUMENTER_RELACHE()
+#  define INSTRUMENTER_AMELIORATION(estNouveau)
+#endif
+
+#endif
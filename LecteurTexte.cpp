@@ -0,0 +1,192 @@
+/**
+ * \file   LecteurTexte.cpp
+ * \brief  Fichier contenant l'implémentation de la lecture d'un graphe en format texte
+ */
+
+#include "LecteurTexte.h"
+#include "FichierProjete.h"
+#include "Instrumentation.h"
+
+#include <stdexcept>
+#include <sstream>
+#include <limits>
+
+using namespace std;
+
+namespace {
+
+/**
+ * \class Lecteur
+ * \brief Balayage d'un tampon en mémoire, un caractère à la fois, avec suivi du numéro de ligne
+ *        pour les messages d'erreur. Les entiers sont lus sans passer par les flux ni la locale.
+ */
+class Lecteur {
+public:
+	Lecteur(const string & p_nomFichier, const char * p_debut, size_t p_taille) :
+			m_nomFichier(p_nomFichier), m_position(p_debut), m_fin(p_debut + p_taille), m_ligne(1) {
+	}
+
+	//! \brief lève une exception qui indique le fichier et la ligne courante
+	void erreur(const string & p_message) const {
+		ostringstream message;
+		message << m_nomFichier << ":" << m_ligne << ": " << p_message;
+		throw logic_error(message.str());
+	}
+
+	//! \brief saute les espaces et les tabulations, sans changer de ligne
+	void sauterEspaces() {
+		while (m_position != m_fin && (*m_position == ' ' || *m_position == '\t'))
+			++m_position;
+	}
+
+	//! \brief lit un entier non signé précédé d'espaces
+	unsigned int lireEntier(const char * p_quoi) {
+		sauterEspaces();
+		if (m_position == m_fin || *m_position < '0' || *m_position > '9')
+			erreur(string("entier attendu (") + p_quoi + ")");
+		unsigned long long valeur = 0;
+		while (m_position != m_fin && *m_position >= '0' && *m_position <= '9') {
+			valeur = valeur * 10 + (*m_position - '0');
+			if (valeur > numeric_limits<unsigned int>::max())
+				erreur(string(p_quoi) + " trop grand");
+			++m_position;
+		}
+		return valeur;
+	}
+
+	//! \brief lit le reste de la ligne, sans les espaces de début et de fin; la ligne doit ensuite être finie par finirLigne()
+	void lireReste(const char * & p_debut, size_t & p_longueur) {
+		sauterEspaces();
+		const char * debut = m_position;
+		while (m_position != m_fin && *m_position != '\n')
+			++m_position;
+		const char * fin = m_position;
+		while (fin != debut && (fin[-1] == '\r' || fin[-1] == ' ' || fin[-1] == '\t'))
+			--fin;
+		p_debut = debut;
+		p_longueur = fin - debut;
+	}
+
+	//! \brief exige la fin de la ligne courante (seuls des espaces peuvent suivre) et passe à la suivante
+	void finirLigne() {
+		sauterEspaces();
+		if (m_position != m_fin && *m_position == '\r')
+			++m_position;
+		if (m_position != m_fin && *m_position != '\n')
+			erreur("fin de ligne attendue");
+		passerLigne();
+	}
+
+	//! \brief saute les lignes vides; vrai s'il reste autre chose que des blancs dans le fichier
+	bool resteDuTexte() {
+		for (;;) {
+			sauterEspaces();
+			if (m_position == m_fin)
+				return false;
+			if (*m_position == '\r')
+				++m_position;
+			if (m_position == m_fin)
+				return false;
+			if (*m_position != '\n')
+				return true;
+			passerLigne();
+		}
+	}
+
+private:
+	void passerLigne() {
+		if (m_position != m_fin) {
+			++m_position;
+			++m_ligne;
+		}
+	}
+
+	const string & m_nomFichier;
+	const char * m_position;
+	const char * m_fin;
+	unsigned int m_ligne;
+};
+
+}
+
+/**
+ * \brief Lit un graphe en format texte (voir LecteurTexte.h)
+ * \brief le fichier est projeté en mémoire et balayé une seule fois; les noms sont d'abord copiés,
+ * \brief bout à bout, dans une seule zone de caractères, et les arcs sont rangés directement en format CSR
+ * \param[in] p_nomFichier le fichier à lire
+ * \param[in] p_attente le délai d'attente ajouté au coût de chaque arc
+ * \return le graphe, figé; un arc donné plusieurs fois garde son dernier coût, comme avec Graphe::figer()
+ * \post une ligne mal formée, un numéro de sommet invalide ou un sommet sans nom lève une exception
+ *       dont le message donne le numéro de la ligne fautive
+ */
+Graphe<string, unsigned int> chargerGrapheTexte(const string & p_nomFichier, unsigned int p_attente) {
+	typedef GrapheCSR<unsigned int>::arc arc;
+
+	INSTRUMENTER_PHASE(phase, "texte: projection");
+	FichierProjete fichier(p_nomFichier);
+	Lecteur lecteur(p_nomFichier, fichier.reqDonnees(), fichier.reqTaille());
+
+	const unsigned int nbSommets = lecteur.lireEntier("nombre de sommets");
+	const unsigned int nbArcs = lecteur.lireEntier("nombre d'arcs");
+	lecteur.finirLigne();
+
+	INSTRUMENTER_ENCHAINER(phase, "texte: noms");
+	//les noms, bout à bout; debutsNoms[i] == AUCUN tant que le sommet i n'est pas nommé
+	const unsigned int AUCUN = numeric_limits<unsigned int>::max();
+	string zoneNoms;
+	zoneNoms.reserve(fichier.reqTaille());
+	vector<unsigned int> debutsNoms(nbSommets, AUCUN);
+	vector<unsigned int> longueursNoms(nbSommets, 0);
+	for (unsigned int i = 0; i < nbSommets; ++i) {
+		lecteur.resteDuTexte();
+		const unsigned int sommet = lecteur.lireEntier("numéro de sommet");
+		if (sommet >= nbSommets)
+			lecteur.erreur("numéro de sommet hors limites");
+		if (debutsNoms[sommet] != AUCUN)
+			lecteur.erreur("sommet nommé deux fois");
+		const char * nom;
+		size_t longueur;
+		lecteur.lireReste(nom, longueur);
+		if (longueur == 0)
+			lecteur.erreur("nom de sommet manquant");
+		lecteur.finirLigne();
+		debutsNoms[sommet] = zoneNoms.size();
+		longueursNoms[sommet] = longueur;
+		zoneNoms.append(nom, longueur);
+	}
+
+	const char * separateur;
+	size_t longueur;
+	lecteur.resteDuTexte();
+	lecteur.lireReste(separateur, longueur);
+	if (longueur != 1 || *separateur != '$')
+		lecteur.erreur("ligne '$' attendue");
+	lecteur.finirLigne();
+
+	INSTRUMENTER_ENCHAINER(phase, "texte: arcs");
+	vector<arc> arcs;
+	arcs.reserve(nbArcs);
+	for (unsigned int i = 0; i < nbArcs; ++i) {
+		lecteur.resteDuTexte();
+		const unsigned int origine = lecteur.lireEntier("origine");
+		const unsigned int destination = lecteur.lireEntier("destination");
+		const unsigned int coutArc = lecteur.lireEntier("coût");
+		if (origine >= nbSommets || destination >= nbSommets)
+			lecteur.erreur("numéro de sommet hors limites");
+		if (coutArc > numeric_limits<unsigned int>::max() - p_attente)
+			lecteur.erreur("coût trop grand");
+		lecteur.finirLigne();
+		arcs.push_back(arc(origine, destination, coutArc + p_attente));
+	}
+	if (lecteur.resteDuTexte())
+		lecteur.erreur("données en trop après le dernier arc");
+
+	INSTRUMENTER_ENCHAINER(phase, "texte: rangement");
+	vector<string> noms(nbSommets);
+	for (unsigned int i = 0; i < nbSommets; ++i)
+		noms[i].assign(zoneNoms, debutsNoms[i], longueursNoms[i]);
+
+	//un arc répété garde son dernier poids, comme dans Graphe::figer()
+	GrapheCSR<unsigned int> arcsAvant = GrapheCSR<unsigned int>(nbSommets, arcs).fusionnerDoublons();
+	return Graphe<string, unsigned int>(noms, arcsAvant, arcsAvant.transposer());
+}
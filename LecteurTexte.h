@@ -0,0 +1,21 @@
+/**
+ * \file   LecteurTexte.h
+ * \brief  Fichier contenant la déclaration de la lecture d'un graphe en format texte (format de Metro.txt)
+ *
+ * Le format est:
+ *  - une ligne d'en-tête: nombre de sommets n, nombre d'arcs m;
+ *  - n lignes "numéro nom", le nom allant jusqu'à la fin de la ligne;
+ *  - une ligne ne contenant que '$';
+ *  - m lignes "origine destination coût"; un arc donné plusieurs fois garde son dernier coût.
+ */
+
+#ifndef LECTEURTEXTE_H
+#define LECTEURTEXTE_H
+
+#include <string>
+
+#include "Graphe.h"
+
+Graphe<std::string, unsigned int> chargerGrapheTexte(const std::string & p_nomFichier, unsigned int p_attente);
+
+#endif
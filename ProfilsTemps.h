@@ -0,0 +1,62 @@
+//
+//  ProfilsTemps.h
+//  durées de parcours des arcs qui dépendent de l'heure de départ (fonctions linéaires par morceaux)
+//
+
+#ifndef PROFILSTEMPS_H
+#define PROFILSTEMPS_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ContratException.h"
+#include "GrapheCSR.h"
+
+//! \brief Patron de classe pour les profils de durée de parcours des arcs d'un GrapheCSR
+//! \brief Le profil d'un arc est une fonction périodique, linéaire par morceaux, donnée par ses points
+//! \brief (instant de départ dans la période, durée); entre deux points, la durée est interpolée, et
+//! \brief le dernier point est relié au premier de la période suivante. Un arc sans profil a une durée
+//! \brief constante, son poids. Les profils doivent respecter la propriété FIFO: partir plus tard
+//! \brief ne fait jamais arriver plus tôt (pente >= -1 entre deux points).
+//! \brief Les points de tous les arcs sont rangés bout à bout dans un seul tableau, dans l'ordre des
+//! \brief index d'arcs du CSR: une relaxation ne lit que les quelques points contigus de son arc, et
+//! \brief un arc constant (un seul point) ne demande aucune recherche.
+//! \brief N est le type entier pour les instants et les durées
+template <typename N>
+class ProfilsTemps
+{
+public:
+	//! \brief un point d'un profil: partir à l'instant instant prend duree
+	struct point
+	{
+		N instant;
+		N duree;
+		point(N p_instant, N p_duree) : instant(p_instant), duree(p_duree){}
+	};
+
+	ProfilsTemps();
+
+	void construire(const GrapheCSR<N> & p_arcs, N p_periode, const std::vector< std::vector<point> > & p_profils,
+			unsigned long p_version = 0);
+
+	N evaluer(unsigned int k, N p_depart) const;
+	size_t reqNbArcs() const;
+	N reqPeriode() const;
+	N reqDureeMax() const;
+	size_t reqNbPoints() const;
+	unsigned long reqVersion() const;
+
+private:
+	static bool estFIFO(const std::vector<point> & p_points, N p_periode);
+
+	N m_periode;
+	unsigned long m_version;          /*!< version du graphe dont les arcs ont servi à la construction */
+	N m_dureeMax;                     /*!< la plus grande durée de tous les profils */
+	std::vector<unsigned int> m_debuts; /*!< nbArcs+1 index: premier point de chaque arc */
+	std::vector<point> m_points;        /*!< les points, arc par arc, en ordre croissant d'instant */
+};
+
+
+#include "ProfilsTemps.hpp"
+
+#endif
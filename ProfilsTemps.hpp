@@ -0,0 +1,158 @@
+//
+//  ProfilsTemps.hpp
+//  durées de parcours des arcs qui dépendent de l'heure de départ (fonctions linéaires par morceaux)
+//
+
+#include <stdexcept>
+
+#include "ProfilsTemps.h"
+
+//! \brief		Constructeur sans paramètre
+//! \post		Des profils vides sont créés; construire() doit être appelé avant toute évaluation
+template<typename N>
+ProfilsTemps<N>::ProfilsTemps() : m_periode(1), m_version(0), m_dureeMax(0), m_debuts(1, 0)
+{
+}
+
+//! \brief		Construit les profils des arcs de p_arcs
+//! \param[in]	p_arcs les arcs, dont les poids servent de durée constante aux arcs sans profil
+//! \param[in]	p_periode la période des profils (par exemple 86400 secondes)
+//! \param[in]	p_profils un profil par index d'arc de p_arcs, ou vide (ou absent) pour une durée constante;
+//! \param[in]	les points d'un profil sont en ordre strictement croissant d'instant, dans [0, p_periode[
+//! \param[in]	p_version la version du graphe dont viennent les arcs (Graphe::reqVersion())
+//! \post		un profil non FIFO ou mal formé lève une exception logic_error
+template<typename N>
+void ProfilsTemps<N>::construire(const GrapheCSR<N> & p_arcs, N p_periode, const std::vector< std::vector<point> > & p_profils,
+		unsigned long p_version)
+{
+	PRECONDITION(p_periode > 0 && p_profils.size() <= p_arcs.reqNbArcs());
+
+	const size_t nbArcs = p_arcs.reqNbArcs();
+	m_periode = p_periode;
+	m_version = p_version;
+	m_dureeMax = 0;
+	m_debuts.assign(nbArcs + 1, 0);
+	m_points.clear();
+	for (unsigned int k = 0; k < nbArcs; ++k)
+	{
+		if (k < p_profils.size() && !p_profils[k].empty())
+		{
+			if (!estFIFO(p_profils[k], p_periode))
+				throw std::logic_error("ProfilsTemps::construire(): profil mal ordonné ou non FIFO");
+			m_points.insert(m_points.end(), p_profils[k].begin(), p_profils[k].end());
+		}
+		else
+			m_points.push_back(point(0, p_arcs.reqPoids(k)));
+		m_debuts[k + 1] = m_points.size();
+	}
+	for (typename std::vector<point>::const_iterator itr = m_points.begin(); itr != m_points.end(); ++itr)
+		if (m_dureeMax < itr->duree)
+			m_dureeMax = itr->duree;
+}
+
+//! \brief		Durée de parcours de l'arc k pour un départ à l'instant p_depart
+//! \note		p_depart peut dépasser la période: seul p_depart modulo la période compte
+template<typename N>
+N ProfilsTemps<N>::evaluer(unsigned int k, N p_depart) const
+{
+	const point * debut = &m_points[0] + m_debuts[k];
+	const point * fin = &m_points[0] + m_debuts[k + 1];
+	if (fin - debut == 1)
+		return debut->duree;
+
+	//précédent: le dernier point d'instant <= t; suivant: le point d'après (celui de la période suivante au bout)
+	const N t = p_depart % m_periode;
+	const point * suivant = debut;
+	for (ptrdiff_t nb = fin - debut; nb > 0; )
+	{
+		ptrdiff_t moitie = nb / 2;
+		if (t < suivant[moitie].instant)
+			nb = moitie;
+		else
+		{
+			suivant += moitie + 1;
+			nb -= moitie + 1;
+		}
+	}
+	long long instantPrecedent, instantSuivant;
+	N dureePrecedente, dureeSuivante;
+	if (suivant == debut)
+	{
+		instantPrecedent = (long long) (fin - 1)->instant - (long long) m_periode;
+		dureePrecedente = (fin - 1)->duree;
+	}
+	else
+	{
+		instantPrecedent = (suivant - 1)->instant;
+		dureePrecedente = (suivant - 1)->duree;
+	}
+	if (suivant == fin)
+	{
+		instantSuivant = (long long) debut->instant + (long long) m_periode;
+		dureeSuivante = debut->duree;
+	}
+	else
+	{
+		instantSuivant = suivant->instant;
+		dureeSuivante = suivant->duree;
+	}
+
+	long long ecart = (long long) dureeSuivante - (long long) dureePrecedente;
+	return static_cast<N>((long long) dureePrecedente + ecart * ((long long) t - instantPrecedent) / (instantSuivant - instantPrecedent));
+}
+
+//! \brief		Obtient le nombre d'arcs
+template<typename N>
+size_t ProfilsTemps<N>::reqNbArcs() const
+{
+	return m_debuts.size() - 1;
+}
+
+//! \brief		Obtient la période des profils
+template<typename N>
+N ProfilsTemps<N>::reqPeriode() const
+{
+	return m_periode;
+}
+
+//! \brief		Obtient la plus grande durée de parcours d'un arc
+template<typename N>
+N ProfilsTemps<N>::reqDureeMax() const
+{
+	return m_dureeMax;
+}
+
+//! \brief		Obtient le nombre total de points rangés
+template<typename N>
+size_t ProfilsTemps<N>::reqNbPoints() const
+{
+	return m_points.size();
+}
+
+//! \brief		Obtient la version du graphe pour laquelle les profils ont été construits
+template<typename N>
+unsigned long ProfilsTemps<N>::reqVersion() const
+{
+	return m_version;
+}
+
+//! \brief		Vérifie que les instants sont croissants dans la période et que la pente est >= -1 partout,
+//! \brief		y compris du dernier point au premier de la période suivante
+template<typename N>
+bool ProfilsTemps<N>::estFIFO(const std::vector<point> & p_points, N p_periode)
+{
+	for (size_t i = 0; i < p_points.size(); ++i)
+	{
+		if (!(p_points[i].instant < p_periode) || (i > 0 && !(p_points[i - 1].instant < p_points[i].instant)))
+			return false;
+		const point & precedent = p_points[i];
+		const point & suivant = p_points[(i + 1) % p_points.size()];
+		long long ecartInstants = (long long) suivant.instant - (long long) precedent.instant;
+		if (i + 1 == p_points.size())
+			ecartInstants += p_periode;
+		//arriver à instant + duree doit croître: duree suivante - duree précédente >= -ecart
+		if ((long long) suivant.duree - (long long) precedent.duree < -ecartInstants)
+			return false;
+	}
+	return true;
+}
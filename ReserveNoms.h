@@ -0,0 +1,46 @@
+//
+//  ReserveNoms.h
+//  réserve de noms partagés: chaque nom distinct n'est rangé qu'une fois
+//
+
+#ifndef RESERVENOMS_H
+#define RESERVENOMS_H
+
+#include <vector>
+#include <limits>
+#include <functional>
+#include <cstddef>
+
+#include "ContratException.h"
+
+//! \brief Patron de classe qui attribue à chaque valeur distincte un numéro (une poignée)
+//! \brief les valeurs sont rangées une seule fois, dans l'ordre de leur première insertion;
+//! \brief une table de hachage à adressage ouvert retrouve la poignée d'une valeur
+//! \brief les poignées et les références obtenues restent valides tant que la réserve n'est pas modifiée
+//! \brief T est le type des noms; std::hash<T> et operator== doivent exister
+template <typename T>
+class ReserveNoms
+{
+public:
+	ReserveNoms();
+
+	unsigned int interner(const T & p_nom);
+	unsigned int trouver(const T & p_nom) const;
+
+	const T & reqNom(unsigned int p_poignee) const;
+	size_t reqNbNoms() const;
+
+	static const unsigned int AUCUN = std::numeric_limits<unsigned int>::max();
+
+private:
+	size_t chercherAlveole(const T & p_nom) const;
+	void agrandir();
+
+	std::vector<T> m_noms;                /*!< les noms distincts, par poignée */
+	std::vector<unsigned int> m_alveoles; /*!< table de hachage: poignée ou AUCUN; taille puissance de 2 */
+};
+
+
+#include "ReserveNoms.hpp"
+
+#endif
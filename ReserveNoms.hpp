@@ -0,0 +1,79 @@
+//
+//  ReserveNoms.hpp
+//  réserve de noms partagés: chaque nom distinct n'est rangé qu'une fois
+//
+
+#include "ReserveNoms.h"
+
+template<typename T>
+const unsigned int ReserveNoms<T>::AUCUN;
+
+//! \brief		Constructeur sans paramètre
+//! \post		Une réserve vide est créée
+template<typename T>
+ReserveNoms<T>::ReserveNoms() : m_alveoles(16, AUCUN)
+{
+}
+
+//! \brief		Obtient la poignée d'un nom, en l'ajoutant à la réserve s'il n'y est pas
+//! \param[in]	p_nom le nom
+//! \return		la poignée du nom
+template<typename T>
+unsigned int ReserveNoms<T>::interner(const T & p_nom)
+{
+	size_t alveole = chercherAlveole(p_nom);
+	if (m_alveoles[alveole] != AUCUN)
+		return m_alveoles[alveole];
+
+	unsigned int poignee = m_noms.size();
+	m_noms.push_back(p_nom);
+	m_alveoles[alveole] = poignee;
+	//la table est gardée au plus à moitié pleine
+	if (2 * m_noms.size() > m_alveoles.size())
+		agrandir();
+	return poignee;
+}
+
+//! \brief		Obtient la poignée d'un nom déjà dans la réserve
+//! \return		la poignée, ou AUCUN si le nom n'est pas dans la réserve
+template<typename T>
+unsigned int ReserveNoms<T>::trouver(const T & p_nom) const
+{
+	return m_alveoles[chercherAlveole(p_nom)];
+}
+
+//! \brief		Obtient le nom d'une poignée
+//! \pre		p_poignee doit avoir été donnée par cette réserve
+template<typename T>
+const T & ReserveNoms<T>::reqNom(unsigned int p_poignee) const
+{
+	PRECONDITION(p_poignee < m_noms.size());
+	return m_noms[p_poignee];
+}
+
+//! \brief		Obtient le nombre de noms distincts
+template<typename T>
+size_t ReserveNoms<T>::reqNbNoms() const
+{
+	return m_noms.size();
+}
+
+//! \brief		Sondage linéaire: l'alvéole qui contient p_nom, ou la première alvéole libre rencontrée
+template<typename T>
+size_t ReserveNoms<T>::chercherAlveole(const T & p_nom) const
+{
+	const size_t masque = m_alveoles.size() - 1;
+	size_t alveole = std::hash<T>()(p_nom) & masque;
+	while (m_alveoles[alveole] != AUCUN && !(m_noms[m_alveoles[alveole]] == p_nom))
+		alveole = (alveole + 1) & masque;
+	return alveole;
+}
+
+//! \brief		Double la taille de la table de hachage et y replace toutes les poignées
+template<typename T>
+void ReserveNoms<T>::agrandir()
+{
+	m_alveoles.assign(2 * m_alveoles.size(), AUCUN);
+	for (unsigned int poignee = 0; poignee < m_noms.size(); ++poignee)
+		m_alveoles[chercherAlveole(m_noms[poignee])] = poignee;
+}
@@ -0,0 +1,158 @@
+/**
+ * \file   ServeurRequetes.cpp
+ * \brief  Fichier contenant l'implémentation du traitement en lots de requêtes origine/destination
+ */
+
+#include "ServeurRequetes.h"
+#include "CacheArbres.h"
+
+#include <stdexcept>
+#include <sstream>
+#include <memory>
+#include <algorithm>
+#include <limits>
+#include <stdint.h>
+
+using namespace std;
+
+namespace {
+
+const size_t TAILLE_LOT = 1 << 16;
+const unsigned int AUCUN = numeric_limits<unsigned int>::max();
+
+/**
+ * \brief Lit le prochain lot de requêtes
+ * \return faux s'il n'y a plus de requête
+ * \post le lot se termine quand il est plein ou quand l'entrée n'a plus de caractère disponible sans
+ *       attendre: un client qui envoie ses requêtes une à une reçoit ses réponses sans délai
+ */
+bool lireLot(istream & p_entree, unsigned int p_nbSommets, unsigned long p_numero,
+		vector<unsigned int> & p_origines, vector<unsigned int> & p_destinations) {
+	p_origines.clear();
+	p_destinations.clear();
+	unsigned int origine, destination;
+	while (p_origines.size() < TAILLE_LOT && p_entree >> origine) {
+		if (!(p_entree >> destination)) {
+			ostringstream message;
+			message << "requête " << p_numero + p_origines.size() + 1 << ": destination manquante";
+			throw logic_error(message.str());
+		}
+		if (origine >= p_nbSommets || destination >= p_nbSommets) {
+			ostringstream message;
+			message << "requête " << p_numero + p_origines.size() + 1 << ": sommet invalide";
+			throw logic_error(message.str());
+		}
+		p_origines.push_back(origine);
+		p_destinations.push_back(destination);
+		if (p_entree.rdbuf()->in_avail() <= 0)
+			break;
+	}
+	if (!p_entree && !p_entree.eof()) {
+		ostringstream message;
+		message << "requête " << p_numero + p_origines.size() + 1 << ": entier attendu";
+		throw logic_error(message.str());
+	}
+	return !p_origines.empty();
+}
+
+void ecrire32(ostream & p_sortie, uint32_t p_valeur) {
+	p_sortie.write(reinterpret_cast<const char *>(&p_valeur), sizeof(p_valeur));
+}
+
+}
+
+/**
+ * \brief Répond à toutes les requêtes de p_entree, jusqu'à la fin du flux
+ * \param[in] p_graphe le graphe, figé
+ * \param[in] p_binaire vrai pour des réponses en binaire (p_sortie doit alors être ouvert en mode binaire)
+ * \param[in] p_avecChemins vrai pour écrire les sommets de chaque chemin; sinon, seules les durées sont
+ *            calculées, par une recherche par origine qui s'arrête dès que les destinations du lot sont atteintes
+ * \param[in] p_bassin les fils d'exécution qui se partagent les groupes de requêtes
+ * \return le nombre de requêtes traitées
+ * \post une requête mal formée ou un sommet invalide lève une exception logic_error qui indique son numéro;
+ *       les réponses des lots précédents sont déjà écrites
+ */
+unsigned long servirRequetes(const Graphe<string, unsigned int> & p_graphe, istream & p_entree,
+		ostream & p_sortie, bool p_binaire, bool p_avecChemins, BassinFils & p_bassin) {
+	PRECONDITION(p_graphe.estFige());
+	const unsigned int nbFils = p_bassin.reqNbFils();
+	vector< ContexteRecherche<unsigned int> > contextes(nbFils);
+	vector< unique_ptr< CacheArbres<unsigned int> > > caches;
+	vector< Chemin<string, unsigned int> > chemins(nbFils);
+	const size_t tailleArbre = p_graphe.reqNbSommets() * 2 * sizeof(unsigned int);
+	for (unsigned int f = 0; f < nbFils; ++f)
+		caches.push_back(unique_ptr< CacheArbres<unsigned int> >(new CacheArbres<unsigned int>(tailleArbre)));
+
+	vector<unsigned int> origines, destinations;
+	vector<unsigned int> ordre;                  // les requêtes du lot triées par origine
+	vector<unsigned int> debutsGroupes;          // position dans ordre du début de chaque groupe
+	vector<unsigned int> destinationsTriees, durees;
+	vector< vector<unsigned int> > sommets;      // le chemin de chaque requête, par position dans ordre
+	unsigned long nbRequetes = 0;
+	while (lireLot(p_entree, p_graphe.reqNbSommets(), nbRequetes, origines, destinations)) {
+		const unsigned int taille = origines.size();
+		ordre.resize(taille);
+		for (unsigned int i = 0; i < taille; ++i)
+			ordre[i] = i;
+		stable_sort(ordre.begin(), ordre.end(),
+				[&](unsigned int a, unsigned int b) { return origines[a] < origines[b]; });
+		debutsGroupes.clear();
+		destinationsTriees.resize(taille);
+		for (unsigned int i = 0; i < taille; ++i) {
+			if (i == 0 || origines[ordre[i]] != origines[ordre[i - 1]])
+				debutsGroupes.push_back(i);
+			destinationsTriees[i] = destinations[ordre[i]];
+		}
+		debutsGroupes.push_back(taille);
+		durees.resize(taille);
+		if (p_avecChemins && sommets.size() < taille)
+			sommets.resize(taille);
+
+		p_bassin.executer(debutsGroupes.size() - 1, [&](unsigned int g, unsigned int fil) {
+			const unsigned int debut = debutsGroupes[g], fin = debutsGroupes[g + 1];
+			const unsigned int origine = origines[ordre[debut]];
+			if (!p_avecChemins) {
+				vector<unsigned int> groupe(destinationsTriees.begin() + debut, destinationsTriees.begin() + fin);
+				p_graphe.unAPlusieurs(origine, groupe, &durees[debut], contextes[fil]);
+				return;
+			}
+			//le premier chemin du groupe calcule l'arbre de l'origine; les suivants le retrouvent dans le cache du fil
+			for (unsigned int i = debut; i < fin; ++i) {
+				durees[i] = p_graphe.dijkstraEnCache(origine, destinationsTriees[i], chemins[fil], *caches[fil], contextes[fil]);
+				sommets[i] = chemins[fil].reqSommets();
+			}
+		});
+
+		vector<unsigned int> position(taille);
+		for (unsigned int i = 0; i < taille; ++i)
+			position[ordre[i]] = i;
+		for (unsigned int i = 0; i < taille; ++i) {
+			const unsigned int p = position[i];
+			const bool atteint = durees[p] != AUCUN;
+			if (p_binaire) {
+				ecrire32(p_sortie, origines[i]);
+				ecrire32(p_sortie, destinations[i]);
+				ecrire32(p_sortie, durees[p]);
+				ecrire32(p_sortie, p_avecChemins && atteint ? sommets[p].size() : 0);
+				if (p_avecChemins && atteint && !sommets[p].empty())
+					p_sortie.write(reinterpret_cast<const char *>(&sommets[p][0]), sommets[p].size() * sizeof(uint32_t));
+			}
+			else {
+				p_sortie << origines[i] << ' ' << destinations[i] << ' ';
+				if (atteint)
+					p_sortie << durees[p];
+				else
+					p_sortie << '-';
+				if (p_avecChemins && atteint)
+					for (unsigned int s = 0; s < sommets[p].size(); ++s)
+						p_sortie << ' ' << sommets[p][s];
+				p_sortie << '\n';
+			}
+		}
+		p_sortie.flush();
+		if (!p_sortie)
+			throw logic_error("servirRequetes(): l'écriture a échoué");
+		nbRequetes += taille;
+	}
+	return nbRequetes;
+}
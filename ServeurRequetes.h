@@ -0,0 +1,27 @@
+/**
+ * \file   ServeurRequetes.h
+ * \brief  Fichier contenant la déclaration du traitement en lots de requêtes origine/destination
+ *
+ * L'entrée est une suite de paires "origine destination" (numéros de sommets séparés par des blancs).
+ * Les requêtes sont lues par lots; celles d'un lot sont groupées par origine, de sorte qu'un seul
+ * arbre de plus courts chemins est calculé par origine, et les groupes sont répartis sur un bassin de fils.
+ * Les réponses sont écrites dans l'ordre des requêtes:
+ *  - en texte, une ligne par requête: "origine destination durée", suivie des sommets du chemin si
+ *    demandés; la durée est '-' si la destination n'est pas atteignable;
+ *  - en binaire, des entiers de 32 bits dans l'ordre natif de la machine: origine, destination,
+ *    durée (0xFFFFFFFF si non atteignable), nombre de sommets du chemin (0 sans les chemins), sommets.
+ */
+
+#ifndef SERVEURREQUETES_H
+#define SERVEURREQUETES_H
+
+#include <string>
+#include <iostream>
+
+#include "Graphe.h"
+#include "BassinFils.h"
+
+unsigned long servirRequetes(const Graphe<std::string, unsigned int> & p_graphe, std::istream & p_entree,
+		std::ostream & p_sortie, bool p_binaire, bool p_avecChemins, BassinFils & p_bassin);
+
+#endif
@@ -8,13 +8,22 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <stdexcept>
 #include <cmath>
 #include <ctime>
+#include <cstdlib>
 #include <sys/time.h>
+#include <sys/stat.h>
 
 #include "Graphe.h"
+#include "GrapheBinaire.h"
+#include "LecteurTexte.h"
+#include "CheminsDynamiques.h"
+#include "ProfilsTemps.h"
+#include "ServeurRequetes.h"
+#include "Instrumentation.h"
 #include "ContratException.h"
 
 using namespace std;
@@ -29,36 +38,36 @@ long tempsExecution(const timeval& tv1, const timeval& tv2) {
 	return dtms;
 }
 
-Graphe<string,unsigned int> chargerGraphe(ifstream & p_fichierEntree)
-{
-	PRECONDITION(p_fichierEntree.is_open());
-
-	unsigned int nbStations, noStation, nbLiens;
-	p_fichierEntree >> nbStations >> nbLiens;
-
-	Graphe<string,unsigned int> metro(nbStations);
+const unsigned int ATTENTE = 20; //délai d'attente (en secondes) ajouté au coût de chaque arc
 
-	//Lecture du nom des stations
-	for (unsigned int i = 0; i < nbStations; i++)
+//charge le métro depuis Metro.bin s'il a été écrit après Metro.txt avec le même délai d'attente;
+//sinon, lit Metro.txt et écrit Metro.bin pour les prochaines fois
+Graphe<string,unsigned int> chargerMetro()
+{
+	struct stat texte, binaire;
+	if (stat("Metro.bin", &binaire) == 0 && (stat("Metro.txt", &texte) != 0
+			|| binaire.st_mtim.tv_sec > texte.st_mtim.tv_sec
+			|| (binaire.st_mtim.tv_sec == texte.st_mtim.tv_sec && binaire.st_mtim.tv_nsec > texte.st_mtim.tv_nsec)))
 	{
-		p_fichierEntree >> noStation;
-		p_fichierEntree.ignore();
-		string s;
-		getline(p_fichierEntree, s);
-		metro.nommer(noStation, s);
+		try
+		{
+			return chargerGrapheBinaire("Metro.bin", ATTENTE);
+		}
+		catch (logic_error & e)
+		{
+			cerr << e.what() << ": Metro.bin sera recréé" << endl;
+		}
 	}
 
-	//Lecture des arc et placement des arcs dans le graphe en mémoire
-	string s;
-	getline(p_fichierEntree, s); //ignorer la ligne ne contenant que '$'
-	int s1, s2, l_cout;
-	for (unsigned int i = 0; i < nbLiens; i++)
+	Graphe<string,unsigned int> metro = chargerGrapheTexte("Metro.txt", ATTENTE);
+	try
 	{
-		p_fichierEntree >> s1 >> s2 >> l_cout;
-		metro.ajouteArc(s1, s2, l_cout+20); //on ajoute un 20 secondes de délais d'attente par arc
-		//std::cout << s1 << " " << s2 << " " << l_cout << std::endl;
+		sauvegarderGrapheBinaire(metro, "Metro.bin", ATTENTE);
+	}
+	catch (logic_error & e)
+	{
+		cerr << e.what() << endl;
 	}
-
 	return metro;
 }
 
@@ -67,8 +76,7 @@ int executionUnePaireAncienAlgo()
 	timeval tv1;
 	timeval tv2;
 
-	ifstream fichier("Metro.txt");
-	Graphe<string,unsigned int> metro = chargerGraphe(fichier);
+	Graphe<string,unsigned int> metro = chargerMetro();
 
 	unsigned int numOrigine;
 	unsigned int numDestination;
@@ -110,8 +118,7 @@ int executionUnePaireNouvelAlgo()
 	timeval tv1;
 	timeval tv2;
 
-	ifstream fichier("Metro.txt");
-	Graphe<string,unsigned int> metro = chargerGraphe(fichier);
+	Graphe<string,unsigned int> metro = chargerMetro();
 
 	unsigned int numOrigine;
 	unsigned int numDestination;
@@ -126,7 +133,7 @@ int executionUnePaireNouvelAlgo()
 	if (gettimeofday(&tv1, 0) != 0)
 			throw logic_error("gettimeofday() a échoué");
 
-	vector< pair<unsigned int, string> > chemin;
+	Chemin<string, unsigned int> chemin;
 	duree = metro.dijkstraV2(numOrigine,numDestination,chemin);
 	if (duree == numeric_limits<unsigned int>::max())
 		throw logic_error("Graphe<T,N>::DijkstraCalculerChemins: pas de solution pour cette paire origine/destination");
@@ -136,9 +143,9 @@ int executionUnePaireNouvelAlgo()
 
 	POSTCONDITION(duree >= 0);
 	cout << "Le plus court chemin trouvé par Dijkstra est: " << endl;
-	for (unsigned int i = 0; i < chemin.size(); ++i)
+	for (unsigned int i = 0; i < chemin.reqNbSommets(); ++i)
 	{
-		cout << chemin[i].first << " " << chemin[i].second << endl;
+		cout << chemin.reqSommet(i) << " " << chemin.reqNom(i) << endl;
 	}
 	cout << "avec un temps estimé de " << duree << " secondes" << endl << endl;
 
@@ -155,13 +162,12 @@ int moyenneToutesLesPairesAncienAlgo()
 	timeval tv1;
 	timeval tv2;
 
-	ifstream fichier("Metro.txt");
-	Graphe<string,unsigned int> metro = chargerGraphe(fichier);
+	Graphe<string,unsigned int> metro = chargerMetro();
 
 	unsigned int duree;
 	vector< pair<unsigned int, string> > chemin;
 
-	const unsigned int nbSt = 376;
+	const unsigned int nbSt = metro.reqNbSommets();
 	cout
 			<< "Détermination du temps moyen d'exécution de l'algorithme de plus court chemin, moyenné sur toutes les paires origne/destination..."
 			<< endl;
@@ -193,20 +199,23 @@ int moyenneToutesLesPairesAncienAlgo()
 }
 
 //exécute un algorithme de plus court chemin sur toutes les paires possibles
+//FilePriorite est la politique de file de priorité utilisée par dijkstraV2
+template <typename FilePriorite>
 int moyenneToutesLesPairesNouvelAlgo()
 {
 	timeval tv1;
 	timeval tv2;
 
-	ifstream fichier("Metro.txt");
-	Graphe<string,unsigned int> metro = chargerGraphe(fichier);
+	Graphe<string,unsigned int> metro = chargerMetro();
 
 	unsigned int duree;
-	vector< pair<unsigned int, string> > chemin;
+	Chemin<string, unsigned int> chemin; //les noms ne sont pas copiés
+	ContexteRecherche<unsigned int, FilePriorite> contexte; //réutilisé par toutes les requêtes
 
-	const unsigned int nbSt = 376;
+	const unsigned int nbSt = metro.reqNbSommets();
 	cout
-			<< "Détermination du temps moyen d'exécution de l'algorithme de plus court chemin, moyenné sur toutes les paires origne/destination..."
+			<< "Détermination du temps moyen d'exécution de l'algorithme de plus court chemin ("
+			<< FilePriorite::nom() << "), moyenné sur toutes les paires origne/destination..."
 			<< endl;
 
 	long double sum_avg = 0;
@@ -218,7 +227,7 @@ int moyenneToutesLesPairesNouvelAlgo()
 			{
 				if (gettimeofday(&tv1, 0) != 0)
 					throw logic_error("gettimeofday() a échoué");
-				duree = metro.dijkstraV2(i, j, chemin);
+				duree = metro.dijkstraV2(i, j, chemin, contexte);
 
 				if (gettimeofday(&tv2, 0) != 0)
 					throw logic_error("gettimeofday() a échoué");
@@ -236,26 +245,800 @@ int moyenneToutesLesPairesNouvelAlgo()
 	return 0;
 }
 
+//calcule en parallèle la table des distances de toutes les paires possibles
+int toutesLesPairesParallele()
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+
+	TableDistances<unsigned int> table;
+	BassinFils bassin;
+	cout << "Calcul de toutes les paires origine/destination sur "
+			<< bassin.reqNbFils() << " fil(s) d'exécution..." << endl;
+
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	metro.toutesLesPaires(table, true, bassin);
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+
+	const unsigned int nbSt = metro.reqNbSommets();
+	long double sum_duree = 0;
+	for (unsigned int i = 0; i < nbSt; ++i)
+		for (unsigned int j = 0; j < nbSt; ++j)
+			if (j != i)
+				sum_duree += table.reqDistance(i, j);
+
+	cout << "Durée moyenne d'un trajet = " << sum_duree / (long double) (nbSt * (nbSt - 1))
+			<< " secondes" << endl;
+	cout << "Temps d'exécution = " << tempsExecution(tv1, tv2)
+			<< " microsecondes" << endl << endl;
+
+	return 0;
+}
+
+//calcule une matrice de distances de 200 origines vers 200 destinations: une recherche de dijkstraV2
+//compare Floyd-Warshall par tuiles (noyau AVX2, puis scalaire) aux recherches de toutes les paires
+int floydWarshallMetro()
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+	BassinFils bassin;
+
+	TableDistances<unsigned int> reference;
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	metro.toutesLesPaires(reference, true, bassin);
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	cout << "Toutes les paires (Dijkstra): " << tempsExecution(tv1, tv2) << " microsecondes" << endl;
+
+	const bool avx2 = reqMinPlusAVX2();
+	for (int essai = 0; essai < 2; ++essai)
+	{
+		fixerMinPlusAVX2(avx2 && essai == 0);
+		TableDistances<unsigned int> table;
+		if (gettimeofday(&tv1, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		metro.floydWarshall(table, true, bassin);
+		if (gettimeofday(&tv2, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+
+		unsigned int nbErreurs = 0;
+		vector<unsigned int> chemin;
+		for (unsigned int i = 0; i < nbSt; ++i)
+			for (unsigned int j = 0; j < nbSt; ++j)
+			{
+				unsigned int longueur = 0;
+				if (table.reconstruireChemin(i, j, chemin))
+					for (size_t k = 1; k < chemin.size(); ++k)
+						longueur += metro.reqPoids(chemin[k - 1], chemin[k]);
+				if (table.reqDistance(i, j) != reference.reqDistance(i, j)
+						|| (table.reqDistance(i, j) != numeric_limits<unsigned int>::max() && longueur != table.reqDistance(i, j)))
+					++nbErreurs;
+			}
+		cout << "Floyd-Warshall (" << (reqMinPlusAVX2() ? "AVX2" : "scalaire") << "): " << tempsExecution(tv1, tv2)
+				<< " microsecondes, " << nbErreurs << " erreur(s)" << endl;
+	}
+	fixerMinPlusAVX2(avx2);
+	cout << endl;
+	return 0;
+}
+
+//par paire, une recherche par origine (unAPlusieurs), puis par seaux dans une hiérarchie de contraction
+int matriceDistancesMetro()
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	HierarchieContraction<unsigned int> hierarchie;
+	metro.construireHierarchie(hierarchie);
+	BassinFils bassin;
+
+	const unsigned int nbOrigines = 200, nbDestinations = 200;
+	vector<unsigned int> origines(nbOrigines), destinations(nbDestinations);
+	srand(1);
+	for (unsigned int i = 0; i < nbOrigines; ++i)
+		origines[i] = rand() % metro.reqNbSommets();
+	for (unsigned int j = 0; j < nbDestinations; ++j)
+		destinations[j] = rand() % metro.reqNbSommets();
+
+	vector<unsigned int> reference(nbOrigines * nbDestinations);
+	vector<unsigned int> matrice(nbOrigines * nbDestinations);
+	cout << "Matrice de distances " << nbOrigines << " x " << nbDestinations << " sur "
+			<< bassin.reqNbFils() << " fil(s) d'exécution..." << endl;
+
+	Chemin<string, unsigned int> chemin;
+	ContexteRecherche<unsigned int> contexte;
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	for (unsigned int i = 0; i < nbOrigines; ++i)
+		for (unsigned int j = 0; j < nbDestinations; ++j)
+			reference[i * nbDestinations + j] = metro.dijkstraV2(origines[i], destinations[j], chemin, contexte);
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	cout << "dijkstraV2 par paire: " << tempsExecution(tv1, tv2) << " microsecondes" << endl;
+
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	metro.matriceDistances(origines, destinations, &matrice[0], bassin);
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	cout << "une recherche par origine: " << tempsExecution(tv1, tv2) << " microsecondes"
+			<< (matrice == reference ? "" : " (ERREUR)") << endl;
+
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	metro.matriceDistances(origines, destinations, &matrice[0], hierarchie, bassin);
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	cout << "seaux (hiérarchie de contraction): " << tempsExecution(tv1, tv2) << " microsecondes"
+			<< (matrice == reference ? "" : " (ERREUR)") << endl << endl;
+
+	return 0;
+}
+
+//change au hasard le poids de 2000 arcs (allongement, raccourcissement ou retrait puis remise)
+//et compare l'arbre des plus courts chemins réparé à un calcul complet après chaque changement
+int modificationsDynamiques()
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+	metro.reqPoids(0, 0); //la matrice de valuation doit suivre les changements
+
+	CheminsDynamiques<unsigned int> arbre;
+	arbre.calculer(metro.reqArcs(), 0);
+	vector<unsigned int> tous(nbSt), reference(nbSt);
+	for (unsigned int i = 0; i < nbSt; ++i)
+		tous[i] = i;
+	ContexteRecherche<unsigned int> contexte;
+
+	srand(1);
+	long tempsReparation = 0, tempsCalculComplet = 0;
+	unsigned long nbRepares = 0;
+	unsigned int nbErreurs = 0;
+	const unsigned int nbChangements = 2000;
+	for (unsigned int c = 0; c < nbChangements; ++c)
+	{
+		const GrapheCSR<unsigned int> & arcs = metro.reqArcs();
+		unsigned int k = rand() % arcs.reqNbArcs();
+		unsigned int j = arcs.reqDestination(k);
+		unsigned int i = 0;
+		while (arcs.reqFin(i) <= k)
+			++i;
+		unsigned int ancien = arcs.reqPoids(k);
+		unsigned int nouveau = ancien;
+
+		if (gettimeofday(&tv1, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		switch (rand() % 3)
+		{
+		case 0:
+			nouveau = ancien * 3;
+			metro.modifierPoids(i, j, nouveau);
+			arbre.mettreAJour(metro.reqArcs(), metro.reqArcsInverses(), i, j, ancien);
+			break;
+		case 1:
+			nouveau = ancien / 2 + 1;
+			metro.modifierPoids(i, j, nouveau);
+			arbre.mettreAJour(metro.reqArcs(), metro.reqArcsInverses(), i, j, ancien);
+			break;
+		default:
+			nouveau = numeric_limits<unsigned int>::max();
+			metro.retirerArc(i, j);
+			arbre.mettreAJour(metro.reqArcs(), metro.reqArcsInverses(), i, j, ancien);
+			nbRepares += arbre.reqNbSommetsRepares();
+			if (metro.reqPoids(i, j) != nouveau)
+				++nbErreurs;
+			nouveau = ancien;
+			metro.ajouteArc(i, j, nouveau);
+			metro.figer();
+			arbre.mettreAJour(metro.reqArcs(), metro.reqArcsInverses(), i, j, numeric_limits<unsigned int>::max());
+			break;
+		}
+		if (gettimeofday(&tv2, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		tempsReparation += tempsExecution(tv1, tv2);
+		nbRepares += arbre.reqNbSommetsRepares();
+
+		if (gettimeofday(&tv1, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		metro.unAPlusieurs(0, tous, &reference[0], contexte);
+		if (gettimeofday(&tv2, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		tempsCalculComplet += tempsExecution(tv1, tv2);
+
+		bool erreur = metro.reqPoids(i, j) != nouveau;
+		for (unsigned int v = 0; v < nbSt; ++v)
+			erreur = erreur || arbre.reqDistance(v) != reference[v];
+		if (erreur)
+			++nbErreurs;
+	}
+
+	cout << nbChangements << " changements de poids, " << nbErreurs << " erreur(s)" << endl;
+	cout << "Réparation: " << tempsReparation << " microsecondes, " << nbRepares << " sommets solutionnés" << endl;
+	cout << "Calcul complet: " << tempsCalculComplet << " microsecondes, "
+			<< (unsigned long) nbChangements * nbSt << " sommets solutionnés" << endl << endl;
+	return 0;
+}
+
+//attente moyenne (en secondes) à l'instant p_instant de la journée: longue la nuit, courte aux heures de pointe
+vector< ProfilsTemps<unsigned int>::point > profilAttente(unsigned int p_duree)
+{
+	const unsigned int heure = 3600;
+	const unsigned int instants[] = { 0, 6 * heure, 7 * heure + heure / 2, 9 * heure + heure / 2,
+			16 * heure + heure / 2, 17 * heure + heure / 2, 19 * heure + heure / 2, 22 * heure };
+	const unsigned int attentes[] = { 300, 180, 60, 180, 180, 60, 180, 300 };
+	vector< ProfilsTemps<unsigned int>::point > points;
+	for (unsigned int i = 0; i < sizeof(instants) / sizeof(instants[0]); ++i)
+		points.push_back(ProfilsTemps<unsigned int>::point(instants[i], p_duree + attentes[i]));
+	return points;
+}
+
+//compare les trajets selon l'heure de départ: avec des profils constants, dijkstraHoraire() doit donner
+//les mêmes durées que dijkstraV2(); avec des attentes qui varient dans la journée, l'arrivée annoncée doit
+//correspondre au parcours du chemin obtenu
+int trajetsSelonHeure()
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+	const GrapheCSR<unsigned int> & arcs = metro.reqArcs();
+	const unsigned int jour = 24 * 3600;
+
+	ProfilsTemps<unsigned int> constants;
+	constants.construire(arcs, jour, vector< vector< ProfilsTemps<unsigned int>::point > >(), metro.reqVersion());
+	vector< vector< ProfilsTemps<unsigned int>::point > > attentes(arcs.reqNbArcs());
+	for (unsigned int k = 0; k < arcs.reqNbArcs(); ++k)
+		attentes[k] = profilAttente(arcs.reqPoids(k) > ATTENTE ? arcs.reqPoids(k) - ATTENTE : 0);
+	ProfilsTemps<unsigned int> horaires;
+	horaires.construire(arcs, jour, attentes, metro.reqVersion());
+
+	Chemin<string, unsigned int> chemin;
+	ContexteRecherche<unsigned int> contexte;
+	unsigned int nbErreurs = 0;
+	long tempsStatique = 0, tempsConstant = 0;
+	for (unsigned int i = 0; i < nbSt; i += 10)
+		for (unsigned int j = 0; j < nbSt; ++j)
+		{
+			if (gettimeofday(&tv1, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			unsigned int duree = metro.dijkstraV2(i, j, chemin, contexte);
+			if (gettimeofday(&tv2, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			tempsStatique += tempsExecution(tv1, tv2);
+
+			metro.dijkstraHoraire(i, j, 8 * 3600, constants, chemin, contexte);
+			if (gettimeofday(&tv1, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			tempsConstant += tempsExecution(tv2, tv1);
+			if (chemin.reqLongueur() != duree)
+				++nbErreurs;
+		}
+	cout << "Profils constants: " << nbErreurs << " erreur(s); dijkstraV2 " << tempsStatique
+			<< " microsecondes, dijkstraHoraire " << tempsConstant << " microsecondes" << endl;
+
+	const unsigned int departs[] = { 3 * 3600, 8 * 3600, 12 * 3600, 18 * 3600, 23 * 3600 + 1800 };
+	for (unsigned int d = 0; d < sizeof(departs) / sizeof(departs[0]); ++d)
+	{
+		double somme = 0;
+		unsigned long nb = 0;
+		nbErreurs = 0;
+		if (gettimeofday(&tv1, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		for (unsigned int i = 0; i < nbSt; i += 10)
+			for (unsigned int j = 0; j < nbSt; ++j)
+			{
+				unsigned int arrivee = metro.dijkstraHoraire(i, j, departs[d], horaires, chemin, contexte);
+				if (!chemin.estTrouve())
+					continue;
+				unsigned int instant = departs[d];
+				for (unsigned int s = 0; s + 1 < chemin.reqNbSommets(); ++s)
+				{
+					unsigned int k = arcs.trouverArc(chemin.reqSommet(s), chemin.reqSommet(s + 1));
+					instant += horaires.evaluer(k, instant);
+				}
+				if (instant != arrivee)
+					++nbErreurs;
+				somme += chemin.reqLongueur();
+				++nb;
+			}
+		if (gettimeofday(&tv2, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		cout << "Départ à " << departs[d] / 3600 << "h" << (departs[d] % 3600) / 60 << ": durée moyenne = "
+				<< somme / nb << " secondes, " << nbErreurs << " erreur(s), "
+				<< tempsExecution(tv1, tv2) << " microsecondes" << endl;
+	}
+	cout << horaires.reqNbPoints() << " points pour " << arcs.reqNbArcs() << " arcs" << endl << endl;
+	return 0;
+}
+
+//durée d'un chemin quand l'attente n'est comptée qu'à la montée et aux correspondances
+unsigned int dureeAvecMontees(const Graphe<string,unsigned int> & p_metro, const Chemin<string,unsigned int> & p_chemin)
+{
+	unsigned int duree = 0;
+	for (unsigned int s = 0; s + 1 < p_chemin.reqNbSommets(); ++s)
+	{
+		unsigned int i = p_chemin.reqSommet(s), j = p_chemin.reqSommet(s + 1);
+		unsigned int poids = p_metro.reqPoids(i, j);
+		duree += (s == 0 || p_metro.estCorrespondance(i, j)) ? poids : poids - ATTENTE;
+	}
+	return duree;
+}
+
+//compare, sur toutes les paires, l'attente forfaitaire sur chaque arc (dijkstraV2), l'attente comptée à la montée
+//et aux correspondances seulement, et le trajet qui minimise les correspondances, puis la durée
+int comparerCorrespondances()
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+
+	Chemin<string,unsigned int> chemin, rapide, direct;
+	ContexteRecherche<unsigned int> contexte;
+	ContexteRecherche<unsigned long long> contexteCorrespondances;
+	double sommeForfait = 0, sommeRapide = 0, sommeDirect = 0;
+	unsigned long correspondancesForfait = 0, correspondancesRapide = 0, correspondancesDirect = 0, nb = 0;
+	unsigned int nbErreurs = 0;
+	long tempsForfait = 0, tempsRapide = 0, tempsDirect = 0;
+	for (unsigned int i = 0; i < nbSt; ++i)
+		for (unsigned int j = 0; j < nbSt; ++j)
+		{
+			if (gettimeofday(&tv1, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			metro.dijkstraV2(i, j, chemin, contexte);
+			if (gettimeofday(&tv2, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			tempsForfait += tempsExecution(tv1, tv2);
+			metro.dijkstraCorrespondances(i, j, ATTENTE, false, rapide, contexteCorrespondances);
+			if (gettimeofday(&tv1, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			tempsRapide += tempsExecution(tv2, tv1);
+			metro.dijkstraCorrespondances(i, j, ATTENTE, true, direct, contexteCorrespondances);
+			if (gettimeofday(&tv2, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			tempsDirect += tempsExecution(tv1, tv2);
+			if (!chemin.estTrouve())
+				continue;
+
+			unsigned int nbRapide = metro.compterCorrespondances(rapide), nbDirect = metro.compterCorrespondances(direct);
+			if (rapide.reqLongueur() != dureeAvecMontees(metro, rapide) || direct.reqLongueur() != dureeAvecMontees(metro, direct)
+					|| rapide.reqLongueur() > dureeAvecMontees(metro, chemin) || nbDirect > nbRapide
+					|| (nbDirect == nbRapide && direct.reqLongueur() != rapide.reqLongueur()))
+				++nbErreurs;
+			sommeForfait += chemin.reqLongueur();
+			sommeRapide += rapide.reqLongueur();
+			sommeDirect += direct.reqLongueur();
+			correspondancesForfait += metro.compterCorrespondances(chemin);
+			correspondancesRapide += nbRapide;
+			correspondancesDirect += nbDirect;
+			++nb;
+		}
+
+	cout << nb << " paires, " << nbErreurs << " erreur(s)" << endl;
+	cout << "Attente sur chaque arc: " << sommeForfait / nb << " secondes, " << double(correspondancesForfait) / nb
+			<< " correspondances, " << tempsForfait << " microsecondes" << endl;
+	cout << "Attente à la montée: " << sommeRapide / nb << " secondes, " << double(correspondancesRapide) / nb
+			<< " correspondances, " << tempsRapide << " microsecondes" << endl;
+	cout << "Moins de correspondances: " << sommeDirect / nb << " secondes, " << double(correspondancesDirect) / nb
+			<< " correspondances, " << tempsDirect << " microsecondes" << endl << endl;
+	return 0;
+}
+
+//front de Pareto (durée, correspondances) pour toutes les paires, comparé à dijkstraV2() et aux deux extrêmes
+//donnés par dijkstraCorrespondances(); p_maxEtiquettes borne le nombre d'étiquettes par sommet
+int frontParetoMetro(unsigned int p_maxEtiquettes)
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+
+	Chemin<string,unsigned int> chemin, rapide, direct;
+	vector< Chemin<string,unsigned int> > front;
+	ContexteRecherche<unsigned int> contexte;
+	ContexteRecherche<unsigned long long> contexteCorrespondances;
+	ContextePareto<unsigned int> contextePareto;
+	unsigned long tailleFronts = 0, nbIncomplets = 0, nb = 0;
+	unsigned int nbErreurs = 0;
+	long tempsV2 = 0, tempsPareto = 0;
+	for (unsigned int i = 0; i < nbSt; ++i)
+		for (unsigned int j = 0; j < nbSt; ++j)
+		{
+			if (gettimeofday(&tv1, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			metro.dijkstraV2(i, j, chemin, contexte);
+			if (gettimeofday(&tv2, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			tempsV2 += tempsExecution(tv1, tv2);
+			metro.frontPareto(i, j, ATTENTE, front, p_maxEtiquettes, contextePareto);
+			if (gettimeofday(&tv1, 0) != 0)
+				throw logic_error("gettimeofday() a échoué");
+			tempsPareto += tempsExecution(tv2, tv1);
+			if (!chemin.estTrouve())
+				continue;
+
+			metro.dijkstraCorrespondances(i, j, ATTENTE, false, rapide, contexteCorrespondances);
+			metro.dijkstraCorrespondances(i, j, ATTENTE, true, direct, contexteCorrespondances);
+			bool erreur = front.empty();
+			for (unsigned int f = 0; !erreur && f < front.size(); ++f)
+				erreur = front[f].reqLongueur() != dureeAvecMontees(metro, front[f])
+						|| (f > 0 && metro.compterCorrespondances(front[f]) >= metro.compterCorrespondances(front[f - 1]));
+			if (erreur || front.front().reqLongueur() != rapide.reqLongueur())
+				++nbErreurs;
+			else if (metro.compterCorrespondances(front.back()) != metro.compterCorrespondances(direct)
+					|| front.back().reqLongueur() != direct.reqLongueur())
+				++nbIncomplets;
+			tailleFronts += front.size();
+			++nb;
+		}
+
+	cout << "Front de Pareto (au plus " << p_maxEtiquettes << " étiquettes par sommet): " << nb << " paires, "
+			<< nbErreurs << " erreur(s), " << nbIncomplets << " front(s) incomplet(s), "
+			<< double(tailleFronts) / nb << " chemins par front" << endl;
+	cout << "dijkstraV2: " << tempsV2 << " microsecondes, frontPareto: " << tempsPareto << " microsecondes" << endl << endl;
+	return 0;
+}
+
+//calcule les p_k plus courts chemins de chaque origine (un sommet sur 10) vers chaque destination,
+//vérifie qu'ils sont distincts, sans boucle et en ordre de longueur, et affiche ceux d'une paire
+int itinerairesAlternatifs(unsigned int p_k)
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+
+	vector< Chemin<string,unsigned int> > chemins;
+	ContexteRecherche<unsigned int> contexte;
+	unsigned long nbChemins = 0, nbPaires = 0;
+	unsigned int nbErreurs = 0;
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	for (unsigned int i = 0; i < nbSt; i += 10)
+		for (unsigned int j = 0; j < nbSt; ++j)
+		{
+			metro.kPlusCourtsChemins(i, j, p_k, chemins, contexte);
+			set< vector<unsigned int> > distincts;
+			bool erreur = false;
+			for (unsigned int c = 0; c < chemins.size(); ++c)
+			{
+				const vector<unsigned int> & sommets = chemins[c].reqSommets();
+				erreur = erreur || !distincts.insert(sommets).second
+						|| set<unsigned int>(sommets.begin(), sommets.end()).size() != sommets.size()
+						|| (c > 0 && chemins[c].reqLongueur() < chemins[c - 1].reqLongueur());
+			}
+			if (erreur)
+				++nbErreurs;
+			nbChemins += chemins.size();
+			++nbPaires;
+		}
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	cout << nbPaires << " paires, " << nbChemins << " chemins, " << nbErreurs << " erreur(s), "
+			<< tempsExecution(tv1, tv2) / nbPaires << " microsecondes par paire (k = " << p_k << ")" << endl;
+
+	metro.kPlusCourtsChemins(0, nbSt - 1, p_k, chemins, contexte);
+	for (unsigned int c = 0; c < chemins.size(); ++c)
+	{
+		cout << chemins[c].reqLongueur() << " s:";
+		for (unsigned int s = 0; s < chemins[c].reqNbSommets(); ++s)
+			if (s == 0 || chemins[c].reqNom(s) != chemins[c].reqNom(s - 1))
+				cout << (s == 0 ? " " : ", ") << chemins[c].reqNom(s);
+		cout << endl;
+	}
+	cout << endl;
+	return 0;
+}
+
+//répond à 100 000 requêtes dont 80 % partent de 8 grandes stations, avec et sans cache des arbres,
+//sur tous les fils d'exécution qui partagent un même cache; puis change un arc et vérifie que le cache suit
+int cacheOrigines()
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+	const unsigned int nbRequetes = 100000;
+
+	srand(1);
+	vector<unsigned int> hubs;
+	for (unsigned int h = 0; h < 8; ++h)
+		hubs.push_back(rand() % nbSt);
+	vector< pair<unsigned int, unsigned int> > requetes;
+	for (unsigned int r = 0; r < nbRequetes; ++r)
+		requetes.push_back(make_pair(rand() % 5 != 0 ? hubs[rand() % hubs.size()] : rand() % nbSt, rand() % nbSt));
+
+	BassinFils bassin;
+	vector< ContexteRecherche<unsigned int> > contextes(bassin.reqNbFils());
+	vector< Chemin<string,unsigned int> > chemins(bassin.reqNbFils());
+	vector<unsigned int> reference(nbRequetes), resultat(nbRequetes);
+
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	bassin.executer(nbRequetes, [&](unsigned int r, unsigned int fil)
+	{
+		reference[r] = metro.dijkstraV2(requetes[r].first, requetes[r].second, chemins[fil], contextes[fil]);
+	});
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	cout << "Sans cache: " << tempsExecution(tv1, tv2) << " microsecondes" << endl;
+
+	CacheArbres<unsigned int> cache(16 * nbSt * (sizeof(unsigned int) + sizeof(unsigned int)));
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	bassin.executer(nbRequetes, [&](unsigned int r, unsigned int fil)
+	{
+		resultat[r] = metro.dijkstraEnCache(requetes[r].first, requetes[r].second, chemins[fil], cache, contextes[fil]);
+	});
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	cout << "Avec cache de 16 arbres: " << tempsExecution(tv1, tv2) << " microsecondes, " << cache.reqNbSucces()
+			<< " succès, " << cache.reqNbEchecs() << " échecs" << (resultat == reference ? "" : " (ERREUR)") << endl;
+
+	//allonger tous les arcs qui quittent le premier hub périme les arbres en cache
+	const GrapheCSR<unsigned int> & arcs = metro.reqArcs();
+	for (unsigned int k = arcs.reqDebut(hubs[0]); k < arcs.reqFin(hubs[0]); ++k)
+		metro.modifierPoids(hubs[0], arcs.reqDestination(k), arcs.reqPoids(k) + 600);
+	unsigned int nbErreurs = 0;
+	Chemin<string,unsigned int> chemin;
+	for (unsigned int r = 0; r < 1000; ++r)
+		if (metro.dijkstraEnCache(requetes[r].first, requetes[r].second, chemin, cache, contextes[0])
+				!= metro.dijkstraV2(requetes[r].first, requetes[r].second, chemin, contextes[0]))
+			++nbErreurs;
+	cout << "Après changement: " << nbErreurs << " erreur(s), " << cache.reqNbArbres() << " arbres en cache" << endl << endl;
+	return 0;
+}
+
+//compteurs et durées des phases de dijkstra(), dijkstraV2() et du chargement, à compiler avec -DINSTRUMENTATION
+//écrit un résumé, une ligne par requête dans requetes.csv et la trace (chrome://tracing) dans trace.json
+int instrumentationMetro()
+{
+	if (!Instrumentation::estCompilee())
+		cout << "Instrumentation absente: recompiler avec -DINSTRUMENTATION" << endl;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+
+	srand(1);
+	vector< pair<unsigned int, unsigned int> > requetes;
+	for (unsigned int r = 0; r < 1000; ++r)
+		requetes.push_back(make_pair(rand() % nbSt, rand() % nbSt));
+
+	BassinFils bassin;
+	vector< ContexteRecherche<unsigned int> > contextes(bassin.reqNbFils());
+	vector< Chemin<string,unsigned int> > chemins(bassin.reqNbFils());
+	bassin.executer(requetes.size(), [&](unsigned int r, unsigned int fil)
+	{
+		metro.dijkstraV2(requetes[r].first, requetes[r].second, chemins[fil], contextes[fil]);
+	});
+	vector< pair<unsigned int, string> > chemin;
+	for (unsigned int r = 0; r < 20; ++r)
+		metro.dijkstra(requetes[r].first, requetes[r].second, chemin);
+
+	Instrumentation::ecrireResume(cout);
+	ofstream csv("requetes.csv");
+	Instrumentation::ecrireRequetes(csv);
+	ofstream trace("trace.json");
+	Instrumentation::ecrireTrace(trace);
+	if (!csv || !trace)
+		throw logic_error("instrumentationMetro(): l'écriture de requetes.csv ou de trace.json a échoué");
+	cout << "Requêtes écrites dans requetes.csv, trace dans trace.json" << endl << endl;
+	return 0;
+}
+
+//mode serveur: charge le métro une seule fois, puis répond aux paires origine/destination lues
+//sur l'entrée standard (ou dans p_arguments[2] s'il ne commence pas par "--") jusqu'à la fin du flux
+//options: --binaire pour des réponses binaires, --chemins pour écrire les sommets des chemins
+int serveurRequetes(int p_nbArguments, char * p_arguments[])
+{
+	timeval tv1;
+	timeval tv2;
+
+	bool binaire = false, avecChemins = false;
+	string nomFichier;
+	for (int a = 2; a < p_nbArguments; ++a)
+	{
+		string argument(p_arguments[a]);
+		if (argument == "--binaire")
+			binaire = true;
+		else if (argument == "--chemins")
+			avecChemins = true;
+		else if (argument.compare(0, 2, "--") != 0 && nomFichier.empty())
+			nomFichier = argument;
+		else
+			throw logic_error("option inconnue: " + argument);
+	}
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	BassinFils bassin;
+	ios::sync_with_stdio(false);
+	ifstream fichier;
+	if (!nomFichier.empty())
+	{
+		fichier.open(nomFichier.c_str());
+		if (!fichier)
+			throw logic_error("impossible d'ouvrir " + nomFichier);
+	}
+
+	if (gettimeofday(&tv1, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	unsigned long nb;
+	try
+	{
+		nb = servirRequetes(metro, nomFichier.empty() ? cin : fichier, cout, binaire, avecChemins, bassin);
+	}
+	catch (logic_error & e)
+	{
+		cerr << e.what() << endl;
+		return 1;
+	}
+	if (gettimeofday(&tv2, 0) != 0)
+		throw logic_error("gettimeofday() a échoué");
+	long duree = tempsExecution(tv1, tv2);
+	cerr << nb << " requêtes en " << duree << " microsecondes ("
+			<< (duree > 0 ? nb * 1000000.0 / duree : 0) << " requêtes par seconde)" << endl;
+	return 0;
+}
+
+//fait passer 200 000 requêtes au hasard par servirRequetes(), avec et sans les chemins,
+//et compare les durées répondues à celles de dijkstraV2()
+int serveurRequetesMetro()
+{
+	timeval tv1;
+	timeval tv2;
+
+	Graphe<string,unsigned int> metro = chargerMetro();
+	const unsigned int nbSt = metro.reqNbSommets();
+	const unsigned int nbRequetes = 200000;
+	BassinFils bassin;
+
+	srand(1);
+	ostringstream requetes;
+	vector< pair<unsigned int, unsigned int> > paires;
+	for (unsigned int r = 0; r < nbRequetes; ++r)
+	{
+		paires.push_back(make_pair(rand() % nbSt, rand() % nbSt));
+		requetes << paires.back().first << ' ' << paires.back().second << '\n';
+	}
+
+	for (int avecChemins = 0; avecChemins < 2; ++avecChemins)
+	{
+		istringstream entree(requetes.str());
+		ostringstream sortie;
+		if (gettimeofday(&tv1, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		unsigned long nb = servirRequetes(metro, entree, sortie, false, avecChemins != 0, bassin);
+		if (gettimeofday(&tv2, 0) != 0)
+			throw logic_error("gettimeofday() a échoué");
+		long duree = tempsExecution(tv1, tv2);
+
+		istringstream reponses(sortie.str());
+		ContexteRecherche<unsigned int> contexte;
+		Chemin<string,unsigned int> chemin;
+		unsigned int nbErreurs = 0;
+		string ligne;
+		for (unsigned int r = 0; r < nbRequetes && getline(reponses, ligne); ++r)
+		{
+			istringstream champs(ligne);
+			unsigned int origine, destination, reponse;
+			champs >> origine >> destination >> reponse;
+			if (origine != paires[r].first || destination != paires[r].second
+					|| reponse != metro.dijkstraV2(origine, destination, chemin, contexte))
+				++nbErreurs;
+		}
+		cout << nb << " requêtes " << (avecChemins ? "avec" : "sans") << " les chemins: " << duree << " microsecondes ("
+				<< nb * 1000000.0 / duree << " requêtes par seconde), " << nbErreurs << " erreur(s)" << endl;
+	}
+	cout << endl;
+	return 0;
+}
+
 int moyenneToutesLesPaires20fois()
 {
 	for (int i = 0; i < 20; i++)
 	{
-		moyenneToutesLesPairesNouvelAlgo();
+		moyenneToutesLesPairesNouvelAlgo< TasDAire<unsigned int> >();
 	}
 	return 0;
 }
 
+//compare les politiques de file de priorité de dijkstraV2 sur toutes les paires possibles
+int moyenneToutesLesPairesFilesPriorite()
+{
+	moyenneToutesLesPairesNouvelAlgo< FileEnsemble<unsigned int> >();
+	moyenneToutesLesPairesNouvelAlgo< TasDAire<unsigned int, 2> >();
+	moyenneToutesLesPairesNouvelAlgo< TasDAire<unsigned int, 4> >();
+	moyenneToutesLesPairesNouvelAlgo< TasRadix<unsigned int> >();
+	moyenneToutesLesPairesNouvelAlgo< FileDial<unsigned int> >();
+	return 0;
+}
+
+//lit la table des repères ALT de p_nomFichier si elle existe et correspond au graphe (mêmes arcs et mêmes poids);
+//sinon, la calcule avec p_nbReperes repères et l'enregistre pour les prochaines exécutions
+void chargerOuCalculerReperes(const Graphe<string,unsigned int> & p_metro, const string & p_nomFichier,
+		unsigned int p_nbReperes, TableReperes & p_reperes)
+{
+	ifstream entree(p_nomFichier.c_str(), ios::binary);
+	if (entree.is_open())
+	{
+		try
+		{
+			p_reperes.charger(entree, p_metro.reqArcs().calculerEmpreinte());
+			if (p_reperes.reqNbSommets() == p_metro.reqNbSommets() && p_reperes.reqNbReperes() == p_nbReperes)
+			{
+				p_reperes.fixerVersion(p_metro.reqVersion());
+				return;
+			}
+		}
+		catch (logic_error &)
+		{
+			//table illisible: on la recalcule
+		}
+	}
+
+	p_metro.calculerReperes(p_nbReperes, p_reperes);
+	ofstream sortie(p_nomFichier.c_str(), ios::binary);
+	p_reperes.sauvegarder(sortie);
+}
+
+//vérifie qu'un chemin trouvé par p_nomAlgo va de p_origine à p_destination, que sa longueur
+//est p_duree et que cette longueur est celle de l'algorithme de référence
+//(entre plusieurs plus courts chemins, seule la longueur est comparée)
+bool verifierChemin(const Graphe<string,unsigned int> & p_metro, unsigned int p_origine,
+		unsigned int p_destination, unsigned int p_dureeReference, const string & p_nomAlgo,
+		unsigned int p_duree, const vector< pair<unsigned int, string> > & p_chemin)
+{
+	unsigned int longueur = 0;
+	bool valide = !p_chemin.empty() && p_chemin.front().first == p_origine && p_chemin.back().first == p_destination;
+	for (unsigned int k = 1; valide && k < p_chemin.size(); ++k)
+	{
+		unsigned int poids = p_metro.reqPoids(p_chemin[k - 1].first, p_chemin[k].first);
+		valide = poids != numeric_limits<unsigned int>::max();
+		longueur += poids;
+	}
+
+	if (p_duree != p_dureeReference || !valide || longueur != p_duree)
+	{
+		cout << "Erreur " << p_nomAlgo << "\nOrigine:" << p_origine << "\nDestination:" << p_destination
+				<< "\nDurée algo fourni:" << p_dureeReference << "\nDurée " << p_nomAlgo << ":" << p_duree
+				<< "\nLongueur du chemin:" << (valide ? longueur : numeric_limits<unsigned int>::max())
+				<< "\n**************\n";
+		return false;
+	}
+	return true;
+}
+
 void comparerAlgo()
 {
-	ifstream fichier1("Metro.txt");
-	Graphe<string,unsigned int> metro = chargerGraphe(fichier1);
-	ifstream fichier2("Metro.txt");
-	Graphe<string,unsigned int> metro2 = chargerGraphe(fichier2);
+	Graphe<string,unsigned int> metro = chargerMetro();
 
 	vector< pair<unsigned int, string> > chemin;
 	vector< pair<unsigned int, string> > chemin2;
+	vector< pair<unsigned int, string> > chemin3;
 
-	const unsigned int nbSt = 376;
+	TableReperes reperes;
+	chargerOuCalculerReperes(metro, "Metro.alt", 8, reperes);
+	HierarchieContraction<unsigned int> hierarchie;
+	metro.construireHierarchie(hierarchie);
+
+	const unsigned int nbSt = metro.reqNbSommets();
 
 	for (unsigned int i = 0; i < nbSt; ++i) {
 		cout << "Pour origine " << i << "\n";
@@ -266,16 +1049,23 @@ void comparerAlgo()
 				int duree = metro.dijkstra(i, j, chemin);
 				int duree2 = metro.dijkstraV2(i, j, chemin2);
 
+				unsigned int duree3 = metro.dijkstraBidirectionnel(i, j, chemin3);
+				verifierChemin(metro, i, j, duree, "bidirectionnel", duree3, chemin3);
+				duree3 = metro.dijkstraALT(i, j, chemin3, reperes);
+				verifierChemin(metro, i, j, duree, "ALT", duree3, chemin3);
+				duree3 = metro.dijkstraCH(i, j, chemin3, hierarchie);
+				verifierChemin(metro, i, j, duree, "hiérarchie de contraction", duree3, chemin3);
+
 				if (duree != duree2)
 				{
 					cout << "Erreur taille des chemins\nOrigine:" << i << "\nDestination:"<<j<<"\nDurée algo fourni:"<<duree<<"\nDurée nouvel algo:" << duree2 <<"\n**************\n" ;
 				}
 				else
 				{
-					bool erreurChemin = false;
+					bool erreurChemin = chemin.size() != chemin2.size();
 					for (unsigned int k = 0; erreurChemin == false && k < chemin.size(); k++)
 					{
-						if (chemin[k].first != chemin[k].first)
+						if (chemin[k].first != chemin2[k].first)
 						{
 							erreurChemin = true;
 						}
@@ -290,7 +1080,7 @@ void comparerAlgo()
 							cout << chemin[k].first << " " << chemin[k].second << endl;
 						}
 						cout << "Le plus court chemin trouvé par le nouvel algo est: " << endl;
-						for (unsigned int k = 0; i < chemin2.size(); ++k)
+						for (unsigned int k = 0; k < chemin2.size(); ++k)
 						{
 							cout << chemin2[k].first << " " << chemin2[k].second << endl;
 						}
@@ -301,8 +1091,61 @@ void comparerAlgo()
 	}
 }
 
-int main()
+//compare la recherche d'une station à une autre (tous les quais à la fois) au meilleur
+//des plus courts chemins de chaque quai d'origine vers chaque quai de destination
+void comparerStations()
 {
+	Graphe<string,unsigned int> metro = chargerMetro();
+	TableDistances<unsigned int> table;
+	metro.toutesLesPaires(table, false);
+
+	//une station par nom distinct, avec ses quais
+	vector<string> stations;
+	vector< vector<unsigned int> > quais;
+	set<string> dejaVus;
+	for (unsigned int i = 0; i < metro.reqNbSommets(); ++i)
+	{
+		if (dejaVus.insert(metro.reqNom(i)).second)
+		{
+			stations.push_back(metro.reqNom(i));
+			quais.push_back(vector<unsigned int>());
+			metro.trouverSommets(stations.back(), quais.back());
+		}
+	}
+
+	Chemin<string, unsigned int> chemin;
+	vector< pair<unsigned int, string> > etapes;
+	ContexteRecherche<unsigned int> contexte;
+	unsigned int nbErreurs = 0;
+	for (unsigned int a = 0; a < stations.size(); ++a)
+	{
+		for (unsigned int b = 0; b < stations.size(); ++b)
+		{
+			unsigned int reference = numeric_limits<unsigned int>::max();
+			for (unsigned int i = 0; i < quais[a].size(); ++i)
+				for (unsigned int j = 0; j < quais[b].size(); ++j)
+					reference = min(reference, table.reqDistance(quais[a][i], quais[b][j]));
+
+			unsigned int duree = metro.dijkstraStations(stations[a], stations[b], chemin, contexte);
+			chemin.exporter(etapes);
+			bool extremitesValides = find(quais[a].begin(), quais[a].end(), chemin.reqSommet(0)) != quais[a].end()
+					&& metro.reqNom(chemin.reqSommet(chemin.reqNbSommets() - 1)) == stations[b];
+			if (!extremitesValides || !verifierChemin(metro, chemin.reqSommet(0), chemin.reqSommet(chemin.reqNbSommets() - 1),
+					reference, "stations", duree, etapes))
+			{
+				cout << "Erreur de " << stations[a] << " à " << stations[b] << "\n";
+				++nbErreurs;
+			}
+		}
+	}
+	cout << stations.size() << " stations, " << nbErreurs << " erreur(s)" << endl;
+}
+
+int main(int argc, char * argv[])
+{
+	if (argc > 1 && string(argv[1]) == "--serveur")
+		return serveurRequetes(argc, argv);
+
 	//comparerAlgo();
 	//while (1)
 	//{
@@ -310,6 +1153,20 @@ int main()
 		//executionUnePaireNouvelAlgo();
 	//}
 //	return moyenneToutesLesPaires();
+//	return moyenneToutesLesPairesFilesPriorite();
+//	return toutesLesPairesParallele();
+//	return floydWarshallMetro();
+//	comparerStations();
+//	return matriceDistancesMetro();
+//	return modificationsDynamiques();
+//	return trajetsSelonHeure();
+//	return comparerCorrespondances();
+//	frontParetoMetro(2);
+//	return frontParetoMetro(16);
+//	return itinerairesAlternatifs(10);
+//	return cacheOrigines();
+//	return instrumentationMetro();
+//	return serveurRequetesMetro();
 	return moyenneToutesLesPaires20fois();
 }
 
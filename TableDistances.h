@@ -0,0 +1,47 @@
+//
+//  TableDistances.h
+//  table contiguë n x n des plus courtes distances entre toutes les paires de sommets
+//
+
+#ifndef TABLEDISTANCES_H
+#define TABLEDISTANCES_H
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+#include "ContratException.h"
+
+//! \brief Patron de classe pour le résultat d'un calcul de toutes les paires
+//! \brief la rangée i contient les distances (et, en option, les prédécesseurs) depuis l'origine i
+//! \brief un chemin se reconstruit en temps proportionnel à sa longueur à partir de la rangée de son origine
+//! \brief N est le type pour les poids
+template <typename N>
+class TableDistances
+{
+public:
+	TableDistances();
+
+	void redimensionner(size_t p_nbSommets, bool p_avecPredecesseurs);
+
+	size_t reqNbSommets() const;
+	bool aPredecesseurs() const;
+
+	const N & reqDistance(unsigned int p_origine, unsigned int p_destination) const;
+	unsigned int reqPredecesseur(unsigned int p_origine, unsigned int p_destination) const;
+	N * reqRangeeDistances(unsigned int p_origine);
+	unsigned int * reqRangeePredecesseurs(unsigned int p_origine);
+
+	bool reconstruireChemin(unsigned int p_origine, unsigned int p_destination,
+							std::vector<unsigned int> & p_chemin) const;
+
+private:
+	size_t m_nbSommets;
+	std::vector<N> m_distances;                /*!< n x n, par rangée d'origine */
+	std::vector<unsigned int> m_predecesseurs; /*!< n x n, par rangée d'origine; vide si non demandé */
+};
+
+
+#include "TableDistances.hpp"
+
+#endif
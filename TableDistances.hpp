@@ -0,0 +1,99 @@
+//
+//  TableDistances.hpp
+//  table contiguë n x n des plus courtes distances entre toutes les paires de sommets
+//
+
+#include <algorithm>
+
+#include "TableDistances.h"
+
+//! \brief		Constructeur sans paramètre
+//! \post		Une table vide est créée
+template<typename N>
+TableDistances<N>::TableDistances() : m_nbSommets(0)
+{
+}
+
+//! \brief		Alloue la table pour p_nbSommets sommets
+//! \param[in]	p_nbSommets le nombre de sommets
+//! \param[in]	p_avecPredecesseurs vrai pour allouer aussi la table des prédécesseurs
+//! \post		toutes les distances sont infinies et aucun sommet n'a de prédécesseur
+template<typename N>
+void TableDistances<N>::redimensionner(size_t p_nbSommets, bool p_avecPredecesseurs)
+{
+	m_nbSommets = p_nbSommets;
+	m_distances.assign(p_nbSommets * p_nbSommets, std::numeric_limits<N>::max());
+	if (p_avecPredecesseurs)
+		m_predecesseurs.assign(p_nbSommets * p_nbSommets, std::numeric_limits<unsigned int>::max());
+	else
+		std::vector<unsigned int>().swap(m_predecesseurs);
+}
+
+template<typename N>
+size_t TableDistances<N>::reqNbSommets() const
+{
+	return m_nbSommets;
+}
+
+//! \brief		Indique si la table des prédécesseurs a été calculée
+template<typename N>
+bool TableDistances<N>::aPredecesseurs() const
+{
+	return !m_predecesseurs.empty() || m_nbSommets == 0;
+}
+
+//! \brief		Obtient la plus courte distance de p_origine à p_destination
+//! \return		numeric_limits<N>::max() si p_destination n'est pas atteignable
+template<typename N>
+const N & TableDistances<N>::reqDistance(unsigned int p_origine, unsigned int p_destination) const
+{
+	PRECONDITION(p_origine < m_nbSommets && p_destination < m_nbSommets);
+	return m_distances[p_origine * m_nbSommets + p_destination];
+}
+
+//! \brief		Obtient le prédécesseur de p_destination sur le plus court chemin depuis p_origine
+//! \pre		la table des prédécesseurs doit avoir été calculée
+template<typename N>
+unsigned int TableDistances<N>::reqPredecesseur(unsigned int p_origine, unsigned int p_destination) const
+{
+	PRECONDITION(p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION(aPredecesseurs());
+	return m_predecesseurs[p_origine * m_nbSommets + p_destination];
+}
+
+//! \brief		Obtient la rangée des distances depuis p_origine (n éléments contigus)
+template<typename N>
+N * TableDistances<N>::reqRangeeDistances(unsigned int p_origine)
+{
+	PRECONDITION(p_origine < m_nbSommets);
+	return &m_distances[p_origine * m_nbSommets];
+}
+
+//! \brief		Obtient la rangée des prédécesseurs depuis p_origine (0 si la table n'a pas été demandée)
+template<typename N>
+unsigned int * TableDistances<N>::reqRangeePredecesseurs(unsigned int p_origine)
+{
+	PRECONDITION(p_origine < m_nbSommets);
+	return m_predecesseurs.empty() ? 0 : &m_predecesseurs[p_origine * m_nbSommets];
+}
+
+//! \brief		Reconstruit le plus court chemin de p_origine à p_destination
+//! \param[out]	p_chemin les sommets du chemin, de p_origine à p_destination (le contenu précédent est effacé)
+//! \return		faux si p_destination n'est pas atteignable (p_chemin est alors vide)
+//! \pre		la table des prédécesseurs doit avoir été calculée
+template<typename N>
+bool TableDistances<N>::reconstruireChemin(unsigned int p_origine, unsigned int p_destination,
+		std::vector<unsigned int> & p_chemin) const
+{
+	PRECONDITION(p_origine < m_nbSommets && p_destination < m_nbSommets);
+	PRECONDITION(aPredecesseurs());
+	p_chemin.clear();
+	if (reqDistance(p_origine, p_destination) == std::numeric_limits<N>::max())
+		return false;
+
+	const unsigned int * rangee = &m_predecesseurs[p_origine * m_nbSommets];
+	for (unsigned int sommet = p_destination; sommet != std::numeric_limits<unsigned int>::max(); sommet = rangee[sommet])
+		p_chemin.push_back(sommet);
+	std::reverse(p_chemin.begin(), p_chemin.end());
+	return true;
+}
@@ -0,0 +1,170 @@
+/**
+ * \file   TableReperes.cpp
+ * \brief  Fichier contenant l'implémentation de la classe TableReperes
+ */
+
+#include "TableReperes.h"
+#include <stdexcept>
+#include <cstring>
+
+using namespace std;
+
+const uint32_t TableReperes::INFINI;
+
+namespace {
+const char SIGNATURE[4] = { 'A', 'L', 'T', 'R' };
+const uint32_t VERSION = 2;
+}
+
+/**
+ * \brief Constructeur sans paramètre: table vide, sans repère
+ */
+TableReperes::TableReperes() :
+		m_nbSommets(0), m_version(0), m_empreinte(0) {
+}
+
+/**
+ * \brief Alloue la table pour p_nbSommets sommets et p_nbReperes repères
+ * \post toutes les distances sont infinies
+ */
+void TableReperes::redimensionner(unsigned int p_nbSommets, unsigned int p_nbReperes) {
+	m_nbSommets = p_nbSommets;
+	m_reperes.assign(p_nbReperes, 0);
+	m_distances.assign((size_t) p_nbSommets * 2 * p_nbReperes, INFINI);
+}
+
+/**
+ * \brief Fixe le sommet du repère numéro p_index
+ */
+void TableReperes::fixerRepere(unsigned int p_index, unsigned int p_sommet) {
+	PRECONDITION(p_index < m_reperes.size() && p_sommet < m_nbSommets);
+	m_reperes[p_index] = p_sommet;
+}
+
+/**
+ * \brief Fixe les distances entre le repère numéro p_index et p_sommet
+ * \param[in] p_depuisRepere la distance du repère à p_sommet
+ * \param[in] p_versRepere la distance de p_sommet au repère
+ */
+void TableReperes::fixerDistances(unsigned int p_index, unsigned int p_sommet,
+		uint32_t p_depuisRepere, uint32_t p_versRepere) {
+	PRECONDITION(p_index < m_reperes.size() && p_sommet < m_nbSommets);
+	size_t base = (size_t) p_sommet * 2 * m_reperes.size() + 2 * p_index;
+	m_distances[base] = p_depuisRepere;
+	m_distances[base + 1] = p_versRepere;
+}
+
+/**
+ * \brief Note la version du graphe (Graphe::reqVersion()) pour laquelle les distances ont été calculées
+ * \note les recherches ALT refusent la table si le graphe a changé depuis
+ */
+void TableReperes::fixerVersion(unsigned long p_version) {
+	m_version = p_version;
+}
+
+/**
+ * \brief Note l'empreinte des arcs (GrapheCSR::calculerEmpreinte()) pour lesquels les distances ont été calculées
+ * \note elle est enregistrée par sauvegarder() et vérifiée par charger()
+ */
+void TableReperes::fixerEmpreinte(uint64_t p_empreinte) {
+	m_empreinte = p_empreinte;
+}
+
+unsigned int TableReperes::reqNbSommets() const {
+	return m_nbSommets;
+}
+
+unsigned int TableReperes::reqNbReperes() const {
+	return m_reperes.size();
+}
+
+unsigned int TableReperes::reqRepere(unsigned int p_index) const {
+	PRECONDITION(p_index < m_reperes.size());
+	return m_reperes[p_index];
+}
+
+/**
+ * \brief Obtient la distance du repère numéro p_index à p_sommet (INFINI si aucun chemin)
+ */
+uint32_t TableReperes::reqDepuisRepere(unsigned int p_index, unsigned int p_sommet) const {
+	PRECONDITION(p_index < m_reperes.size() && p_sommet < m_nbSommets);
+	return m_distances[(size_t) p_sommet * 2 * m_reperes.size() + 2 * p_index];
+}
+
+/**
+ * \brief Obtient la distance de p_sommet au repère numéro p_index (INFINI si aucun chemin)
+ */
+uint32_t TableReperes::reqVersRepere(unsigned int p_index, unsigned int p_sommet) const {
+	PRECONDITION(p_index < m_reperes.size() && p_sommet < m_nbSommets);
+	return m_distances[(size_t) p_sommet * 2 * m_reperes.size() + 2 * p_index + 1];
+}
+
+unsigned long TableReperes::reqVersion() const {
+	return m_version;
+}
+
+uint64_t TableReperes::reqEmpreinte() const {
+	return m_empreinte;
+}
+
+/**
+ * \brief Écrit la table en binaire: signature, version, nombre de sommets, nombre de repères, empreinte
+ *        des arcs (64 bits), les repères puis les distances (entiers de 32 bits dans l'ordre natif de la machine)
+ * \param[in] p_sortie un flux ouvert en mode binaire
+ */
+void TableReperes::sauvegarder(ostream & p_sortie) const {
+	uint32_t entete[3] = { VERSION, m_nbSommets, (uint32_t) m_reperes.size() };
+	p_sortie.write(SIGNATURE, sizeof(SIGNATURE));
+	p_sortie.write(reinterpret_cast<const char *>(entete), sizeof(entete));
+	p_sortie.write(reinterpret_cast<const char *>(&m_empreinte), sizeof(m_empreinte));
+	for (unsigned int i = 0; i < m_reperes.size(); ++i) {
+		uint32_t repere = m_reperes[i];
+		p_sortie.write(reinterpret_cast<const char *>(&repere), sizeof(repere));
+	}
+	if (!m_distances.empty())
+		p_sortie.write(reinterpret_cast<const char *>(&m_distances[0]), m_distances.size() * sizeof(uint32_t));
+	if (!p_sortie)
+		throw logic_error("TableReperes::sauvegarder(): l'écriture a échoué");
+}
+
+/**
+ * \brief Lit une table écrite par sauvegarder()
+ * \param[in] p_entree un flux ouvert en mode binaire
+ * \param[in] p_empreinte l'empreinte des arcs du graphe à guider (GrapheCSR::calculerEmpreinte()); une table
+ *            calculée pour d'autres arcs (autres poids, autre délai d'attente...) est refusée
+ * \post la table précédente est remplacée; en cas d'erreur, une exception est levée
+ * \post la version est remise à 0: fixerVersion() doit être appelée pour le graphe auquel la table correspond
+ */
+void TableReperes::charger(istream & p_entree, uint64_t p_empreinte) {
+	char signature[sizeof(SIGNATURE)];
+	uint32_t entete[3];
+	p_entree.read(signature, sizeof(signature));
+	p_entree.read(reinterpret_cast<char *>(entete), sizeof(entete));
+	if (!p_entree || memcmp(signature, SIGNATURE, sizeof(SIGNATURE)) != 0)
+		throw logic_error("TableReperes::charger(): ce n'est pas une table de repères");
+	if (entete[0] != VERSION)
+		throw logic_error("TableReperes::charger(): version de table non supportée");
+	uint64_t empreinte;
+	p_entree.read(reinterpret_cast<char *>(&empreinte), sizeof(empreinte));
+	if (!p_entree)
+		throw logic_error("TableReperes::charger(): fichier tronqué");
+	if (empreinte != p_empreinte)
+		throw logic_error("TableReperes::charger(): la table a été calculée pour d'autres arcs");
+
+	redimensionner(entete[1], entete[2]);
+	m_version = 0;
+	m_empreinte = empreinte;
+	for (unsigned int i = 0; i < m_reperes.size(); ++i) {
+		uint32_t repere;
+		p_entree.read(reinterpret_cast<char *>(&repere), sizeof(repere));
+		if (!p_entree)
+			throw logic_error("TableReperes::charger(): fichier tronqué");
+		if (repere >= m_nbSommets)
+			throw logic_error("TableReperes::charger(): repère invalide");
+		m_reperes[i] = repere;
+	}
+	if (!m_distances.empty())
+		p_entree.read(reinterpret_cast<char *>(&m_distances[0]), m_distances.size() * sizeof(uint32_t));
+	if (!p_entree)
+		throw logic_error("TableReperes::charger(): fichier tronqué");
+}
@@ -0,0 +1,81 @@
+/**
+ * \file   TableReperes.h
+ * \brief  Fichier contenant la déclaration de la classe TableReperes (prétraitement ALT)
+ */
+
+#ifndef TABLEREPERES_H
+#define TABLEREPERES_H
+
+#include <vector>
+#include <iostream>
+#include <limits>
+#include <stdint.h>
+
+#include "ContratException.h"
+
+/**
+ * \class TableReperes
+ * \brief Distances de chaque sommet vers et depuis k sommets repères, pour la recherche A* ALT.
+ *
+ * Pour chaque sommet v, les 2k distances sont contiguës: depuis le repère l (d(L,v)) à l'index
+ * 2l et vers le repère l (d(v,L)) à l'index 2l+1. Les distances sont stockées sur 32 bits;
+ * INFINI indique qu'il n'existe aucun chemin.
+ * Par l'inégalité du triangle, max(d(v,L) - d(t,L), d(L,t) - d(L,v)) est une borne inférieure
+ * de d(v,t) pour chaque repère L.
+ */
+class TableReperes
+{
+public:
+	static const uint32_t INFINI = std::numeric_limits<uint32_t>::max();
+
+	TableReperes();
+
+	void redimensionner(unsigned int p_nbSommets, unsigned int p_nbReperes);
+	void fixerRepere(unsigned int p_index, unsigned int p_sommet);
+	void fixerDistances(unsigned int p_index, unsigned int p_sommet, uint32_t p_depuisRepere, uint32_t p_versRepere);
+	void fixerVersion(unsigned long p_version);
+	void fixerEmpreinte(uint64_t p_empreinte);
+
+	unsigned int reqNbSommets() const;
+	unsigned int reqNbReperes() const;
+	unsigned int reqRepere(unsigned int p_index) const;
+	uint32_t reqDepuisRepere(unsigned int p_index, unsigned int p_sommet) const;
+	uint32_t reqVersRepere(unsigned int p_index, unsigned int p_sommet) const;
+	unsigned long reqVersion() const;
+	uint64_t reqEmpreinte() const;
+
+	uint32_t borneInferieure(unsigned int p_sommet, unsigned int p_cible) const;
+
+	void sauvegarder(std::ostream & p_sortie) const;
+	void charger(std::istream & p_entree, uint64_t p_empreinte);
+
+private:
+	unsigned int m_nbSommets;
+	unsigned long m_version;               /*!< version du graphe pour laquelle les distances sont valides */
+	uint64_t m_empreinte;                  /*!< empreinte des arcs du graphe (GrapheCSR::calculerEmpreinte()) */
+	std::vector<unsigned int> m_reperes;   /*!< les sommets choisis comme repères */
+	std::vector<uint32_t> m_distances;     /*!< 2k distances par sommet, par sommet */
+};
+
+/**
+ * \brief Borne inférieure de la distance de p_sommet à p_cible
+ * \note définie ici pour être développée en ligne dans la boucle de relaxation
+ */
+inline uint32_t TableReperes::borneInferieure(unsigned int p_sommet, unsigned int p_cible) const {
+	const unsigned int nb = 2 * m_reperes.size();
+	const uint32_t * sommet = &m_distances[(size_t) p_sommet * nb];
+	const uint32_t * cible = &m_distances[(size_t) p_cible * nb];
+	uint32_t borne = 0;
+	for (unsigned int i = 0; i < nb; i += 2) {
+		//d(L,t) - d(L,v)
+		if (cible[i] != INFINI && sommet[i] != INFINI && cible[i] > sommet[i] && cible[i] - sommet[i] > borne)
+			borne = cible[i] - sommet[i];
+		//d(v,L) - d(t,L)
+		if (sommet[i + 1] != INFINI && cible[i + 1] != INFINI && sommet[i + 1] > cible[i + 1]
+				&& sommet[i + 1] - cible[i + 1] > borne)
+			borne = sommet[i + 1] - cible[i + 1];
+	}
+	return borne;
+}
+
+#endif